@@ -0,0 +1,95 @@
+// Solves the same quartics from double, float and compact coefficient storage and reports, per format, the bytes
+// read per polynomial, the solve time and the root error against the double coefficients.
+//
+//     CompactCoefficientsBenchmark [n_quartics]
+
+#include "batch_roots.hpp"
+#include "compact_coefficients.hpp"
+#include "test_polynomials.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+constexpr int repetitions = 5;
+
+/// rows of `std::array<float, 5>` widened to `Real`, so float storage goes through the same path as the others
+template <typename Real>
+struct FloatRows
+{
+    const std::vector<std::array<float, 5>>* quartics;
+
+    [[nodiscard]] std::array<Real, 5> operator[](const std::size_t i) const noexcept
+    {
+        const auto& c = (*quartics)[i];
+        return {c[0], c[1], c[2], c[3], c[4]};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return quartics->size();
+    }
+};
+
+template <typename Real, typename Batch>
+void measure(
+    const char* label,
+    const std::size_t bytes_per_quartic,
+    const std::vector<std::array<double, 5>>& reference,
+    const Batch& rows
+)
+{
+    std::vector<Real> min_roots(std::size(rows));
+    auto best = std::chrono::duration<double>::max();
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        const auto start = std::chrono::steady_clock::now();
+        batch::quartic_min_positive_real_roots<Real>(rows, min_roots.data());
+        best = std::min<std::chrono::duration<double>>(best, std::chrono::steady_clock::now() - start);
+    }
+    const auto report = test::quartic_quantization_report<Real>(reference, rows);
+    std::printf(
+        "%-22s %3zu B  %6.1f ns/quartic   coefficient error %8.2e   root error max %8.2e mean %8.2e   non-finite %zu\n",
+        label, bytes_per_quartic, best.count() * 1e9 / static_cast<double>(reference.size()),
+        report.max_coefficient_error, report.max_root_error, report.mean_root_error, report.n_nonfinite
+    );
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1} << 22;
+    const auto quartics = test::random_real_root_quartics(n, 0.1, 10);
+    std::printf("%zu quartics\n", n);
+
+    measure<double>("double", 40, quartics, quartics);
+
+    std::vector<std::array<float, 5>> floats(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t k = 0; k < 5; ++k) {
+            floats[i][k] = static_cast<float>(quartics[i][k]);
+        }
+    }
+    measure<float>("float", 20, quartics, FloatRows<float>{&floats});
+
+    const auto half = encode<Half>(quartics[0].data(), 5 * n);
+    measure<float>("half -> float", 10, quartics, batch::CompactRows<float, 5, Half>{half.data(), n});
+
+    const auto bfloat16 = encode<BFloat16>(quartics[0].data(), 5 * n);
+    measure<float>("bfloat16 -> float", 10, quartics, batch::CompactRows<float, 5, BFloat16>{bfloat16.data(), n});
+
+    const auto int16 = quantize_block_scaled<std::int16_t>(quartics[0].data(), n, 5);
+    measure<float>("int16 block -> float", 12, quartics, batch::BlockScaledRows<float, 5, std::int16_t>{int16});
+
+    const auto int32 = quantize_block_scaled<std::int32_t>(quartics[0].data(), n, 5);
+    measure<double>("int32 block -> double", 22, quartics, batch::BlockScaledRows<double, 5, std::int32_t>{int32});
+    return 0;
+}
@@ -0,0 +1,173 @@
+// Compares the complex-coefficient closed-form solvers with the workaround of multiplying a complex polynomial P by
+// its coefficient-wise conjugate, solving the real polynomial P * conj(P) of twice the degree with a general
+// (Aberth-Ehrlich) solver and keeping the half of its roots that are roots of P.
+//
+//     ComplexCoefficientBenchmark [n_polynomials]
+
+#include "complex_coefficient_roots.hpp"
+#include "test_polynomials.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace dm::math;
+using Complex = std::complex<double>;
+using dm::math::test::root_error;
+
+namespace {
+
+constexpr int repetitions = 3;
+
+template <std::size_t N>
+struct TestCase
+{
+    std::array<Complex, N + 1> coefficients;
+    std::array<Complex, N> roots;
+};
+
+/// polynomials of degree N with random complex roots in [-3, 3]^2 and a random complex leading coefficient
+template <std::size_t N>
+std::vector<TestCase<N>> make_cases(const std::size_t n)
+{
+    std::mt19937_64 generator{42};
+    std::uniform_real_distribution<double> part{-3, 3};
+    std::vector<TestCase<N>> cases(n);
+    for (auto& test_case : cases) {
+        auto& c = test_case.coefficients;
+        c = {};
+        c[0] = {part(generator), part(generator)};
+        for (std::size_t j = 0; j < N; ++j) {
+            test_case.roots[j] = {part(generator), part(generator)};
+            for (std::size_t k = j + 1; k > 0; --k) {
+                c[k] = c[k - 1] - test_case.roots[j] * c[k];
+            }
+            c[0] *= -test_case.roots[j];
+        }
+    }
+    return cases;
+}
+
+/// Aberth-Ehrlich simultaneous iteration for all roots of the polynomial `c` of degree `c.size() - 1`
+template <std::size_t M>
+std::array<Complex, M - 1> aberth_roots(const std::array<double, M>& c)
+{
+    constexpr std::size_t degree = M - 1;
+    // start on a circle of the Fujiwara radius, rotated off the axes so that no two starting points are conjugates
+    double radius = 0;
+    for (std::size_t k = 0; k < degree; ++k) {
+        radius = std::max(radius, std::pow(std::abs(c[k] / c[degree]), 1.0 / static_cast<double>(degree - k)));
+    }
+    std::array<Complex, degree> z;
+    for (std::size_t j = 0; j < degree; ++j) {
+        z[j] = std::polar(radius, (2 * M_PI * static_cast<double>(j) + 0.4) / static_cast<double>(degree));
+    }
+    for (int iteration = 0; iteration < 100; ++iteration) {
+        bool converged = true;
+        for (std::size_t j = 0; j < degree; ++j) {
+            Complex p = c[degree];
+            Complex derivative = 0;
+            for (std::size_t k = degree; k > 0; --k) {
+                derivative = derivative * z[j] + p;
+                p = p * z[j] + c[k - 1];
+            }
+            const auto newton = p / derivative;
+            Complex repulsion = 0;
+            for (std::size_t l = 0; l < degree; ++l) {
+                if (l != j) {
+                    repulsion += 1.0 / (z[j] - z[l]);
+                }
+            }
+            const auto step = newton / (1.0 - newton * repulsion);
+            z[j] -= step;
+            converged = converged && std::abs(step) <= 1e-14 * std::max(1.0, std::abs(z[j]));
+        }
+        if (converged) {
+            break;
+        }
+    }
+    return z;
+}
+
+/// the workaround: roots of P from those of the real polynomial P * conj(P)
+template <std::size_t N>
+std::array<Complex, N> conjugate_product_roots(const std::array<Complex, N + 1>& c)
+{
+    std::array<double, 2 * N + 1> product{};
+    for (std::size_t k = 0; k <= N; ++k) {
+        for (std::size_t l = 0; l <= N; ++l) {
+            product[k + l] += (c[k] * std::conj(c[l])).real();
+        }
+    }
+    const auto candidates = aberth_roots(product);
+    // every root of P * conj(P) is a root of P or of conj(P); keep the N with the smallest |P(z)|
+    std::array<std::pair<double, Complex>, 2 * N> residuals;
+    for (std::size_t j = 0; j < 2 * N; ++j) {
+        Complex p = c[N];
+        for (std::size_t k = N; k > 0; --k) {
+            p = p * candidates[j] + c[k - 1];
+        }
+        residuals[j] = {std::abs(p), candidates[j]};
+    }
+    std::partial_sort(residuals.begin(), residuals.begin() + N, residuals.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    std::array<Complex, N> roots;
+    for (std::size_t j = 0; j < N; ++j) {
+        roots[j] = residuals[j].second;
+    }
+    return roots;
+}
+
+template <std::size_t N, typename Solve>
+void measure(const char* label, const std::vector<TestCase<N>>& cases, const Solve& solve)
+{
+    std::vector<std::array<Complex, N>> roots(cases.size());
+    auto best = std::chrono::duration<double>::max();
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < cases.size(); ++i) {
+            roots[i] = solve(cases[i].coefficients);
+        }
+        best = std::min<std::chrono::duration<double>>(best, std::chrono::steady_clock::now() - start);
+    }
+    double max_error = 0;
+    std::vector<double> errors(cases.size());
+    for (std::size_t i = 0; i < cases.size(); ++i) {
+        errors[i] = root_error(cases[i].roots, roots[i]);
+        max_error = std::max(max_error, errors[i]);
+    }
+    std::sort(errors.begin(), errors.end());
+    std::printf(
+        "%-32s %8.1f ns/polynomial   root error median %8.2e max %8.2e\n", label,
+        best.count() * 1e9 / static_cast<double>(cases.size()), errors[errors.size() / 2], max_error
+    );
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1} << 16;
+    std::printf("%zu polynomials per degree\n", n);
+
+    const auto quadratics = make_cases<2>(n);
+    measure("quadratic closed form", quadratics, [](const auto& c) { return complex_quadratic_roots<double>(c); });
+    measure("quadratic via degree-4 Aberth", quadratics, [](const auto& c) { return conjugate_product_roots<2>(c); });
+
+    const auto cubics = make_cases<3>(n);
+    measure("cubic closed form", cubics, [](const auto& c) { return complex_cubic_roots<double>(c); });
+    measure("cubic via degree-6 Aberth", cubics, [](const auto& c) { return conjugate_product_roots<3>(c); });
+
+    const auto quartics = make_cases<4>(n);
+    measure("quartic closed form", quartics, [](const auto& c) { return complex_quartic_roots<double>(c); });
+    measure("quartic via degree-8 Aberth", quartics, [](const auto& c) { return conjugate_product_roots<4>(c); });
+    return 0;
+}
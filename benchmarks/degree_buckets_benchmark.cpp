@@ -0,0 +1,90 @@
+// Solves a batch of quartics whose leading coefficients are zeroed at random, so that degrees 1 to 4 are mixed, once
+// through `quartic_real_roots` per element, which falls back to the lower degree solvers polynomial by polynomial, and
+// once through `batch::quartic_real_roots_by_degree`, and reports the time per polynomial of each and of the
+// partitioning alone.
+//
+//     DegreeBucketsBenchmark [n_polynomials]
+
+#include "batch_roots.hpp"
+#include "quartic_roots.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+constexpr int repetitions = 7;
+
+/// polynomials of degree 1 to 4 in equal shares, in random order, with coefficients in [-1, 1]
+std::vector<std::array<double, 5>> make_mixed_degrees(const std::size_t n)
+{
+    std::mt19937_64 generator{35};
+    std::uniform_real_distribution<double> coefficient{-1, 1};
+    std::uniform_int_distribution<std::size_t> degree{1, 4};
+    std::vector<std::array<double, 5>> polynomials(n);
+    for (auto& c : polynomials) {
+        const auto d = degree(generator);
+        for (std::size_t k = 0; k < 5; ++k) {
+            c[k] = (k <= d) ? coefficient(generator) : 0.0;
+        }
+    }
+    return polynomials;
+}
+
+/// best time per polynomial over `repetitions` runs of `solve`, in nanoseconds
+template <typename Solve>
+double time_per_polynomial(const std::size_t n, Solve&& solve)
+{
+    auto best = std::chrono::duration<double>::max();
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        const auto start = std::chrono::steady_clock::now();
+        solve();
+        best = std::min<std::chrono::duration<double>>(best, std::chrono::steady_clock::now() - start);
+    }
+    return best.count() * 1e9 / static_cast<double>(n);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1} << 20;
+    const auto polynomials = make_mixed_degrees(n);
+    std::array<std::vector<double>, 4> roots;
+    for (auto& slot : roots) {
+        slot.resize(n);
+    }
+    const std::array<double*, 4> out{roots[0].data(), roots[1].data(), roots[2].data(), roots[3].data()};
+    std::vector<std::uint8_t> counts(n);
+    batch::DegreeBuckets<double> buckets;
+
+    const auto per_element = time_per_polynomial(n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto [real_roots, n_roots] = quartic_real_roots<double>(polynomials[i]);
+            for (std::size_t j = 0; j < n_roots; ++j) {
+                out[j][i] = real_roots[j];
+            }
+            counts[i] = static_cast<std::uint8_t>(n_roots);
+        }
+    });
+    const auto partition = time_per_polynomial(n, [&] { batch::bucket_by_degree<double>(polynomials, buckets); });
+    const auto by_degree = time_per_polynomial(n, [&] {
+        batch::quartic_real_roots_by_degree<double>(polynomials, out, counts.data(), buckets);
+    });
+
+    std::printf("%zu polynomials of degree 1 to 4\n", n);
+    std::printf("per-element fallback   %6.1f ns/polynomial\n", per_element);
+    std::printf("by degree              %6.1f ns/polynomial\n", by_degree);
+    std::printf("  of which partition   %6.1f ns/polynomial\n", partition);
+    std::printf("  of which solve       %6.1f ns/polynomial\n", by_degree - partition);
+    return 0;
+}
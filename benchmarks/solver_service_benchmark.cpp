@@ -0,0 +1,151 @@
+// Load generator for the solver daemon: forks client processes that each send many small quartic batches and reports
+// throughput, per-request latency and the batch sizes the server coalesced. Without --socket an in-process server is
+// run for each of a few latency budgets; with --socket an external polynomial_roots_daemon is measured instead.
+//
+//     SolverServiceBenchmark [--socket PATH] [--clients N] [--requests N] [--quartics N]
+
+#include "sharded_batch.hpp"
+#include "solver_service.hpp"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct LoadOptions
+{
+    std::size_t n_clients = 32;
+    std::size_t n_requests = 2000;
+    std::size_t n_quartics = 4;
+};
+
+/// runs one client process per slot; returns the wall time and fills `latencies` in microseconds
+double generate_load(const std::string& socket_path, const LoadOptions& load, std::vector<double>& latencies)
+{
+    const auto n_samples = load.n_clients * load.n_requests;
+    const sharded::SharedMapping samples{n_samples * sizeof(double)};
+    auto* shared_latencies = static_cast<double*>(samples.data());
+
+    const auto start = Clock::now();
+    std::vector<pid_t> clients;
+    for (std::size_t k = 0; k < load.n_clients; ++k) {
+        const auto pid = fork();
+        if (pid < 0) {
+            std::perror("fork");
+            std::exit(1);
+        }
+        if (pid == 0) {
+            try {
+                service::Client client{socket_path};
+                std::vector<double> coefficients(5 * load.n_quartics);
+                std::vector<double> real(4 * load.n_quartics);
+                std::vector<double> imag(4 * load.n_quartics);
+                for (std::size_t r = 0; r < load.n_requests; ++r) {
+                    for (std::size_t i = 0; i < load.n_quartics; ++i) {
+                        const auto shift = static_cast<double>((k + r + i) % 17) / 4;
+                        const double c[5]{shift, -1, 2 + shift, -shift, 1};
+                        std::copy(c, c + 5, coefficients.begin() + 5 * i);
+                    }
+                    const auto sent = Clock::now();
+                    client.solve_quartics(coefficients.data(), load.n_quartics, real.data(), imag.data());
+                    shared_latencies[k * load.n_requests + r] =
+                        std::chrono::duration<double, std::micro>(Clock::now() - sent).count();
+                }
+            } catch (const std::exception& error) {
+                std::fprintf(stderr, "client %zu: %s\n", k, error.what());
+                _exit(1);
+            }
+            _exit(0);
+        }
+        clients.push_back(pid);
+    }
+    for (const auto pid : clients) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            std::fprintf(stderr, "a client failed\n");
+            std::exit(1);
+        }
+    }
+    const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    latencies.assign(shared_latencies, shared_latencies + n_samples);
+    std::sort(latencies.begin(), latencies.end());
+    return seconds;
+}
+
+void report(const char* label, const LoadOptions& load, const double seconds, const std::vector<double>& latencies)
+{
+    const auto n_polynomials = static_cast<double>(load.n_clients * load.n_requests * load.n_quartics);
+    std::printf(
+        "%-14s %10.0f quartics/s   latency p50 %7.1f us  p99 %7.1f us", label, n_polynomials / seconds,
+        latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100]
+    );
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    LoadOptions load;
+    std::string socket_path;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const auto value = std::strtoull(argv[i + 1], nullptr, 10);
+        if (std::strcmp(argv[i], "--socket") == 0) {
+            socket_path = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--clients") == 0) {
+            load.n_clients = value;
+        } else if (std::strcmp(argv[i], "--requests") == 0) {
+            load.n_requests = value;
+        } else if (std::strcmp(argv[i], "--quartics") == 0) {
+            load.n_quartics = value;
+        }
+    }
+    std::printf(
+        "%zu clients x %zu requests x %zu quartics\n", load.n_clients, load.n_requests, load.n_quartics
+    );
+
+    std::vector<double> latencies;
+    if (!socket_path.empty()) {
+        const auto seconds = generate_load(socket_path, load, latencies);
+        report("daemon", load, seconds, latencies);
+        std::printf("\n");
+        return 0;
+    }
+
+    socket_path = "/tmp/polynomial_roots_benchmark." + std::to_string(getpid()) + ".sock";
+    for (const auto budget_us : {0, 50, 200, 1000}) {
+        service::ServerOptions options;
+        options.socket_path = socket_path;
+        options.latency_budget = std::chrono::microseconds{budget_us};
+        service::Server server{options};
+        std::thread serving([&server] { server.run(); });
+
+        const auto seconds = generate_load(socket_path, load, latencies);
+        server.stop();
+        serving.join();
+
+        const auto stats = server.stats();
+        const auto label = "budget " + std::to_string(budget_us) + " us";
+        report(label.c_str(), load, seconds, latencies);
+        std::printf(
+            "   mean batch %6.1f quartics\n", static_cast<double>(stats.n_polynomials) / static_cast<double>(stats.n_batches)
+        );
+    }
+    return 0;
+}
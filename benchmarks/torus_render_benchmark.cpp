@@ -0,0 +1,177 @@
+#include "quartic_roots.hpp"
+#include "ray_quartic_surfaces.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+constexpr std::size_t width = 1024;
+constexpr std::size_t height = 768;
+constexpr int repetitions = 5;
+
+/// primary rays of a pinhole camera looking at a tilted torus, already transformed into the torus frame
+struct Scene
+{
+    std::vector<double> origin_x;
+    std::vector<double> origin_y;
+    std::vector<double> origin_z;
+    std::vector<double> direction_x;
+    std::vector<double> direction_y;
+    std::vector<double> direction_z;
+
+    Scene()
+    {
+        const auto tilt = 0.6;
+        const auto c = std::cos(tilt);
+        const auto s = std::sin(tilt);
+        for (std::size_t row = 0; row < height; ++row) {
+            for (std::size_t column = 0; column < width; ++column) {
+                const auto u = (2 * (column + 0.5) / width - 1) * width / height;
+                const auto v = 1 - 2 * (row + 0.5) / height;
+                // camera at (0, -12, 0) looking along +y, rotated about x into the torus frame
+                const Vector3<double> origin{0, -12, 0};
+                const Vector3<double> direction{u * 0.45, 1, v * 0.45};
+                origin_x.push_back(origin.x);
+                origin_y.push_back(c * origin.y - s * origin.z);
+                origin_z.push_back(s * origin.y + c * origin.z);
+                direction_x.push_back(direction.x);
+                direction_y.push_back(c * direction.y - s * direction.z);
+                direction_z.push_back(s * direction.y + c * direction.z);
+            }
+        }
+    }
+
+    [[nodiscard]] batch::RayPacket<double> rays() const noexcept
+    {
+        return {
+            origin_x.data(),
+            origin_y.data(),
+            origin_z.data(),
+            direction_x.data(),
+            direction_y.data(),
+            direction_z.data(),
+            origin_x.size(),
+        };
+    }
+};
+
+/// the per-ray pipeline the kernel replaces: full quartic, sorted real roots, first positive one
+double reference_nearest_hit(const Torus<double>& torus, const Vector3<double>& o, const Vector3<double>& d)
+{
+    const auto [roots, n_roots] = quartic_real_roots_sorted<double>(torus.ray_quartic(o, d));
+    for (std::size_t i = 0; i < n_roots; ++i) {
+        if (roots[i] > 0) {
+            return roots[i];
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+template <typename Render>
+double best_seconds(Render&& render)
+{
+    auto best = std::numeric_limits<double>::infinity();
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        const auto start = std::chrono::steady_clock::now();
+        render();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+std::vector<unsigned char> shade(const Torus<double>& torus, const Scene& scene, const std::vector<double>& t)
+{
+    std::vector<unsigned char> image(t.size());
+    for (std::size_t i = 0; i < t.size(); ++i) {
+        if (std::isinf(t[i])) {
+            continue;
+        }
+        const Vector3<double> p{
+            scene.origin_x[i] + t[i] * scene.direction_x[i],
+            scene.origin_y[i] + t[i] * scene.direction_y[i],
+            scene.origin_z[i] + t[i] * scene.direction_z[i],
+        };
+        const auto n = torus.normal(p);
+        const Vector3<double> d{scene.direction_x[i], scene.direction_y[i], scene.direction_z[i]};
+        const auto lambert = -n.dot(d) / std::sqrt(n.dot(n) * d.dot(d));
+        image[i] = static_cast<unsigned char>(40 + 215 * std::max(0.0, lambert));
+    }
+    return image;
+}
+
+} // namespace
+
+/// Renders a torus into an in-memory image with the packet kernel, with `nearest_hit` per ray and with the per-ray
+/// sorted-roots pipeline, and reports the best of several timings. Pass a path to also write the kernel's image as a
+/// PGM file.
+int main(int argc, char** argv)
+{
+    const Torus<double> torus{3, 1};
+    const Scene scene;
+    const auto n_rays = scene.origin_x.size();
+
+    std::vector<double> kernel_t(n_rays);
+    const auto kernel_seconds = best_seconds([&] { batch::nearest_hits(torus, scene.rays(), kernel_t.data()); });
+
+    std::vector<double> scalar_t(n_rays);
+    const auto scalar_seconds = best_seconds([&] {
+        for (std::size_t i = 0; i < n_rays; ++i) {
+            scalar_t[i] = nearest_hit(
+                torus,
+                Vector3<double>{scene.origin_x[i], scene.origin_y[i], scene.origin_z[i]},
+                Vector3<double>{scene.direction_x[i], scene.direction_y[i], scene.direction_z[i]}
+            );
+        }
+    });
+
+    std::vector<double> reference_t(n_rays);
+    const auto reference_seconds = best_seconds([&] {
+        for (std::size_t i = 0; i < n_rays; ++i) {
+            reference_t[i] = reference_nearest_hit(
+                torus,
+                {scene.origin_x[i], scene.origin_y[i], scene.origin_z[i]},
+                {scene.direction_x[i], scene.direction_y[i], scene.direction_z[i]}
+            );
+        }
+    });
+
+    std::size_t n_hits = 0;
+    std::size_t n_scalar_mismatches = 0;
+    std::size_t n_hit_mismatches = 0;
+    double max_difference = 0;
+    for (std::size_t i = 0; i < n_rays; ++i) {
+        n_hits += !std::isinf(kernel_t[i]);
+        n_scalar_mismatches += kernel_t[i] != scalar_t[i];
+        if (std::isinf(kernel_t[i]) != std::isinf(reference_t[i])) {
+            ++n_hit_mismatches;
+        } else if (!std::isinf(kernel_t[i])) {
+            max_difference = std::max(max_difference, std::abs(kernel_t[i] - reference_t[i]));
+        }
+    }
+
+    std::printf("rays:              %zu (%zu hits)\n", n_rays, n_hits);
+    std::printf("packet kernel:     %8.2f ms  %7.2f Mrays/s\n", 1e3 * kernel_seconds, n_rays / kernel_seconds / 1e6);
+    std::printf("per-ray kernel:    %8.2f ms  %7.2f Mrays/s\n", 1e3 * scalar_seconds, n_rays / scalar_seconds / 1e6);
+    std::printf("sorted quartic:    %8.2f ms  %7.2f Mrays/s\n", 1e3 * reference_seconds, n_rays / reference_seconds / 1e6);
+    std::printf("hit mismatches:    %zu (%zu against per-ray kernel)\n", n_hit_mismatches, n_scalar_mismatches);
+    std::printf("max t difference:  %g\n", max_difference);
+
+    const auto image = shade(torus, scene, kernel_t);
+    if (argc > 1) {
+        std::ofstream file{argv[1], std::ios::binary};
+        file << "P5\n" << width << ' ' << height << "\n255\n";
+        file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+    }
+    return EXIT_SUCCESS;
+}
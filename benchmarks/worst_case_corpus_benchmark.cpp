@@ -0,0 +1,65 @@
+// Replays the worst-case corpus (tests/corpus/quartic_worst_cases.txt by default) and reports, for every entry, the
+// batch solve time per quartic next to that of quartics with random real roots, and its backward error.
+//
+//     WorstCaseCorpusBenchmark [corpus]
+
+#include "batch_roots.hpp"
+#include "test_polynomials.hpp"
+#include "worst_case_corpus.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+constexpr int repetitions = 5;
+constexpr std::size_t batch_size = std::size_t{1} << 12;
+
+/// best of `repetitions` batch solves of `quartics`, in nanoseconds per quartic
+double time_batch(const std::vector<std::array<double, 5>>& quartics)
+{
+    std::vector<double> real(4 * quartics.size());
+    std::vector<double> imag(4 * quartics.size());
+    const auto n = quartics.size();
+    const std::array<double*, 4> real_rows{real.data(), real.data() + n, real.data() + 2 * n, real.data() + 3 * n};
+    const std::array<double*, 4> imag_rows{imag.data(), imag.data() + n, imag.data() + 2 * n, imag.data() + 3 * n};
+    auto best = std::chrono::duration<double>::max();
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        const auto start = std::chrono::steady_clock::now();
+        batch::quartic_roots<double>(quartics, real_rows, imag_rows);
+        best = std::min<std::chrono::duration<double>>(best, std::chrono::steady_clock::now() - start);
+    }
+    return best.count() * 1e9 / static_cast<double>(n);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const auto* path = (argc > 1) ? argv[1] : POLYNOMIAL_ROOTS_WORST_CASE_CORPUS;
+    std::ifstream in{path};
+    if (!in) {
+        std::fprintf(stderr, "%s: cannot read %s\n", argv[0], path);
+        return 1;
+    }
+    const auto corpus = read_corpus(in);
+
+    const auto random = test::random_real_root_quartics(batch_size);
+    std::printf("random real roots         %6.1f ns/quartic\n", time_batch(random));
+    for (const auto& entry : corpus) {
+        const std::vector<std::array<double, 5>> copies(batch_size, entry.coefficients);
+        const auto error = quartic_backward_error(entry.coefficients, quartic_roots<double>(entry.coefficients));
+        std::printf(
+            "%-14s %9.4g  %6.1f ns/quartic   backward error %8.2e\n", to_string(entry.kind), entry.score,
+            time_batch(copies), error
+        );
+    }
+    return 0;
+}
@@ -0,0 +1,238 @@
+#include "batch_kernels.hpp"
+
+#include "coefficient_views.hpp"
+#include "cubic_roots.hpp"
+#include "quadratic_roots.hpp"
+#include "quartic_roots.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Each instruction set gets its own copy of the batch loops. `flatten` inlines the whole solver into the
+// target-specific loop, so the Monic* arithmetic is compiled for that instruction set rather than called through the
+// baseline instantiations; only libm calls such as cbrt and acos remain shared.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DM_POLYROOTS_MULTIVERSION 1
+#else
+#define DM_POLYROOTS_MULTIVERSION 0
+#endif
+
+namespace dm::math::kernels {
+
+namespace {
+
+/// the coefficients of `layout`, whose strides count elements, as a view with byte strides
+template <typename Real, std::size_t N>
+[[nodiscard]] batch::StridedRows<Real, N>
+coefficient_rows(const Real* coefficients, const std::size_t n, const dm_polyroots_layout& layout) noexcept
+{
+    constexpr auto size = static_cast<std::ptrdiff_t>(sizeof(Real));
+    return {coefficients, n, layout.polynomial_stride * size, layout.coefficient_stride * size};
+}
+
+[[nodiscard]] std::ptrdiff_t
+root_offset(const std::size_t i, const std::size_t j, const dm_polyroots_layout& layout) noexcept
+{
+    return static_cast<std::ptrdiff_t>(i) * layout.root_polynomial_stride +
+           static_cast<std::ptrdiff_t>(j) * layout.root_stride;
+}
+
+/// `x`, or the default quiet NaN if `x` is any NaN; the sign of a NaN produced by arithmetic depends on the operand
+/// order the compiler picks, which differs between the instruction set variants
+template <typename Real>
+[[nodiscard]] Real canonical(const Real x) noexcept
+{
+    return (x != x) ? std::numeric_limits<Real>::quiet_NaN() : x;
+}
+
+struct QuarticRoots
+{
+    template <typename Real>
+    [[nodiscard]] auto operator()(const std::array<Real, 5>& c) const noexcept
+    {
+        return quartic_roots<Real>(c);
+    }
+};
+
+struct QuarticRealRoots
+{
+    template <typename Real>
+    [[nodiscard]] auto operator()(const std::array<Real, 5>& c) const noexcept
+    {
+        return quartic_real_roots<Real>(c);
+    }
+};
+
+struct CubicRoots
+{
+    template <typename Real>
+    [[nodiscard]] auto operator()(const std::array<Real, 4>& c) const noexcept
+    {
+        return cubic_roots<Real>(c);
+    }
+};
+
+struct CubicRealRoots
+{
+    template <typename Real>
+    [[nodiscard]] auto operator()(const std::array<Real, 4>& c) const noexcept
+    {
+        return cubic_real_roots<Real>(c);
+    }
+};
+
+struct QuadraticRealRoots
+{
+    template <typename Real>
+    [[nodiscard]] auto operator()(const std::array<Real, 3>& c) const noexcept
+    {
+        return quadratic_real_roots<Real>(c);
+    }
+};
+
+} // namespace
+
+// Defines complex_kernel and real_kernel with the given function attributes, and the table of their instantiations.
+#define DM_POLYROOTS_DEFINE_KERNELS(isa_namespace, isa_value, attributes)                                              \
+    namespace isa_namespace {                                                                                          \
+    template <typename Real, std::size_t N, typename Solve>                                                            \
+    attributes void complex_kernel(                                                                                    \
+        const std::size_t n,                                                                                           \
+        const Real* coefficients,                                                                                      \
+        Real* roots_real,                                                                                              \
+        Real* roots_imag,                                                                                              \
+        const dm_polyroots_layout& layout                                                                              \
+    ) noexcept                                                                                                         \
+    {                                                                                                                  \
+        const auto rows = coefficient_rows<Real, N>(coefficients, n, layout);                                          \
+        for (std::size_t i = 0; i < n; ++i) {                                                                          \
+            const auto roots = Solve{}(rows[i]);                                                                       \
+            for (std::size_t j = 0; j < roots.size(); ++j) {                                                           \
+                roots_real[root_offset(i, j, layout)] = canonical(roots[j].real());                                    \
+                roots_imag[root_offset(i, j, layout)] = canonical(roots[j].imag());                                    \
+            }                                                                                                          \
+        }                                                                                                              \
+    }                                                                                                                  \
+    template <typename Real, std::size_t N, typename Solve>                                                            \
+    attributes void real_kernel(                                                                                       \
+        const std::size_t n,                                                                                           \
+        const Real* coefficients,                                                                                      \
+        Real* roots,                                                                                                   \
+        std::uint8_t* counts,                                                                                          \
+        const dm_polyroots_layout& layout                                                                              \
+    ) noexcept                                                                                                         \
+    {                                                                                                                  \
+        const auto rows = coefficient_rows<Real, N>(coefficients, n, layout);                                          \
+        for (std::size_t i = 0; i < n; ++i) {                                                                          \
+            const auto [real_roots, n_roots] = Solve{}(rows[i]);                                                       \
+            for (std::size_t j = 0; j < n_roots; ++j) {                                                                \
+                roots[root_offset(i, j, layout)] = canonical(real_roots[j]);                                           \
+            }                                                                                                          \
+            counts[i] = static_cast<std::uint8_t>(n_roots);                                                            \
+        }                                                                                                              \
+    }                                                                                                                  \
+    constexpr Kernels kernels{                                                                                         \
+        isa_value,                                                                                                     \
+        &complex_kernel<double, 5, QuarticRoots>,                                                                      \
+        &complex_kernel<float, 5, QuarticRoots>,                                                                       \
+        &real_kernel<double, 5, QuarticRealRoots>,                                                                     \
+        &real_kernel<float, 5, QuarticRealRoots>,                                                                      \
+        &complex_kernel<double, 4, CubicRoots>,                                                                        \
+        &complex_kernel<float, 4, CubicRoots>,                                                                         \
+        &real_kernel<double, 4, CubicRealRoots>,                                                                       \
+        &real_kernel<float, 4, CubicRealRoots>,                                                                        \
+        &real_kernel<double, 3, QuadraticRealRoots>,                                                                   \
+        &real_kernel<float, 3, QuadraticRealRoots>,                                                                    \
+    };                                                                                                                 \
+    }
+
+DM_POLYROOTS_DEFINE_KERNELS(baseline, DM_POLYROOTS_ISA_BASELINE, )
+
+#if DM_POLYROOTS_MULTIVERSION
+DM_POLYROOTS_DEFINE_KERNELS(sse4_2, DM_POLYROOTS_ISA_SSE4_2, __attribute__((target("sse4.2"), flatten)))
+DM_POLYROOTS_DEFINE_KERNELS(avx2, DM_POLYROOTS_ISA_AVX2, __attribute__((target("avx2,fma"), flatten)))
+DM_POLYROOTS_DEFINE_KERNELS(
+    avx512, DM_POLYROOTS_ISA_AVX512, __attribute__((target("avx512f,avx512dq,avx512vl,avx512bw,avx2,fma"), flatten))
+)
+#endif
+
+#undef DM_POLYROOTS_DEFINE_KERNELS
+
+namespace {
+
+[[nodiscard]] dm_polyroots_isa probe_isa() noexcept
+{
+#if DM_POLYROOTS_MULTIVERSION
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("fma")) {
+        return DM_POLYROOTS_ISA_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return DM_POLYROOTS_ISA_AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return DM_POLYROOTS_ISA_SSE4_2;
+    }
+#endif
+    return DM_POLYROOTS_ISA_BASELINE;
+}
+
+[[nodiscard]] std::atomic<const Kernels*>& selection() noexcept
+{
+    static std::atomic<const Kernels*> selected{kernels_for(detected_isa())};
+    return selected;
+}
+
+// resolves the dispatch while the library is loaded rather than on the first call; the function-local statics keep
+// calls from other translation units' static initializers safe
+[[maybe_unused]] const auto& load_time_selection = selection();
+
+} // namespace
+
+dm_polyroots_isa detected_isa() noexcept
+{
+    static const auto isa = probe_isa();
+    return isa;
+}
+
+const Kernels* kernels_for(const dm_polyroots_isa isa) noexcept
+{
+    if (isa > detected_isa()) {
+        return nullptr;
+    }
+    switch (isa) {
+    case DM_POLYROOTS_ISA_BASELINE:
+        return &baseline::kernels;
+#if DM_POLYROOTS_MULTIVERSION
+    case DM_POLYROOTS_ISA_SSE4_2:
+        return &sse4_2::kernels;
+    case DM_POLYROOTS_ISA_AVX2:
+        return &avx2::kernels;
+    case DM_POLYROOTS_ISA_AVX512:
+        return &avx512::kernels;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+const Kernels& selected() noexcept
+{
+    return *selection().load(std::memory_order_acquire);
+}
+
+bool select(const dm_polyroots_isa isa) noexcept
+{
+    const auto* kernels = kernels_for(isa);
+    if (kernels == nullptr) {
+        return false;
+    }
+    selection().store(kernels, std::memory_order_release);
+    return true;
+}
+
+} // namespace dm::math::kernels
@@ -0,0 +1,46 @@
+#pragma once
+
+// Private to the PolynomialRoots::C library: the batch loops behind the C entry points, compiled once per instruction
+// set and selected at load time from the host's CPU features.
+
+#include "polynomial_roots.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dm::math::kernels {
+
+template <typename Real>
+using ComplexKernel = void (*)(std::size_t, const Real*, Real*, Real*, const dm_polyroots_layout&) noexcept;
+
+template <typename Real>
+using RealKernel = void (*)(std::size_t, const Real*, Real*, std::uint8_t*, const dm_polyroots_layout&) noexcept;
+
+struct Kernels
+{
+    dm_polyroots_isa isa;
+    ComplexKernel<double> quartic_roots_f64;
+    ComplexKernel<float> quartic_roots_f32;
+    RealKernel<double> quartic_real_roots_f64;
+    RealKernel<float> quartic_real_roots_f32;
+    ComplexKernel<double> cubic_roots_f64;
+    ComplexKernel<float> cubic_roots_f32;
+    RealKernel<double> cubic_real_roots_f64;
+    RealKernel<float> cubic_real_roots_f32;
+    RealKernel<double> quadratic_real_roots_f64;
+    RealKernel<float> quadratic_real_roots_f32;
+};
+
+/// best instruction set supported by the host, probed once
+[[nodiscard]] dm_polyroots_isa detected_isa() noexcept;
+
+/// kernels compiled for `isa`, or nullptr when the host or this build cannot run them
+[[nodiscard]] const Kernels* kernels_for(dm_polyroots_isa isa) noexcept;
+
+/// kernels used by the C entry points, chosen from `detected_isa()` when the library is loaded
+[[nodiscard]] const Kernels& selected() noexcept;
+
+/// makes the C entry points use the kernels for `isa`, returning false if they cannot run on this host
+bool select(dm_polyroots_isa isa) noexcept;
+
+} // namespace dm::math::kernels
@@ -0,0 +1,359 @@
+#pragma once
+
+#include "quartic_roots.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace dm::math::batch {
+
+// Batch solvers take any `Batch` where `batch[i][j]` is coefficient j of polynomial i and `std::size(batch)` is the
+// number of polynomials. Outputs are structure-of-arrays buffers owned by the caller, one element per polynomial. Only
+// the projected quantity is computed and written, and the output element type may differ from `Real` (e.g. solving in
+// double and storing float).
+
+namespace internal {
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] auto quartic_real_roots(const Coefficients& c, const Real epsilon) noexcept
+    -> std::pair<std::array<Real, 4>, std::size_t>
+{
+    return dm::math::quartic_real_roots<Real>(std::array<Real, 5>{c[0], c[1], c[2], c[3], c[4]}, epsilon);
+}
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] std::size_t quartic_real_root_count(const Coefficients& c, const Real epsilon) noexcept
+{
+    if (c[4] == 0) {
+        return quartic_real_roots<Real>(c, epsilon).second;
+    }
+    return dm::math::internal::MonicQuartic<Real>{c[0] / c[4], c[1] / c[4], c[2] / c[4], c[3] / c[4]}.real_root_count(
+        epsilon
+    );
+}
+
+/// degree of the polynomial `c` of nominal degree `N - 1` once leading coefficients with |c[k]| <= tolerance * max|c|
+/// are dropped; the zero polynomial has degree 0
+template <typename Real, std::size_t N, typename Coefficients>
+[[nodiscard]] std::size_t effective_degree(const Coefficients& c, const Real tolerance) noexcept
+{
+    using std::abs;
+    std::array<Real, N> magnitudes;
+    Real scale = 0;
+    for (std::size_t k = 0; k < N; ++k) {
+        magnitudes[k] = abs(static_cast<Real>(c[k]));
+        scale = (magnitudes[k] > scale) ? magnitudes[k] : scale;
+    }
+    // fixed trip count and selects rather than an early exit, so mixed batches do not mispredict here
+    const auto threshold = tolerance * scale;
+    std::size_t degree = 0;
+    for (std::size_t k = 1; k < N; ++k) {
+        degree = (magnitudes[k] > threshold) ? k : degree;
+    }
+    return degree;
+}
+
+/// Calls `visit(center, half_width)` for the real roots of the quartic `c` in pairs as
+/// `MonicQuartic::visit_real_root_pairs` does; a vanishing leading coefficient falls back to the roots of the lower
+/// degree polynomial, each as a pair of half width 0.
+template <typename Real, typename Coefficients, typename Visit>
+void visit_real_root_pairs(const Coefficients& c, const Real epsilon, Visit&& visit) noexcept
+{
+    if (c[4] == 0) {
+        const auto [roots, n_roots] = quartic_real_roots<Real>(c, epsilon);
+        for (std::size_t j = 0; j < n_roots; ++j) {
+            visit(roots[j], Real{0});
+        }
+        return;
+    }
+    dm::math::internal::MonicQuartic<Real>{c[0] / c[4], c[1] / c[4], c[2] / c[4], c[3] / c[4]}.visit_real_root_pairs(
+        epsilon, visit
+    );
+}
+
+template <typename Out>
+[[nodiscard]] constexpr Out no_root() noexcept
+{
+    return std::numeric_limits<Out>::quiet_NaN();
+}
+
+} // namespace internal
+
+/// number of real roots of each quartic
+template <typename Real, typename Batch, typename Count>
+void quartic_real_root_counts(
+    const Batch& batch, Count* counts, const Real epsilon = std::numeric_limits<Real>::epsilon()
+) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        counts[i] = static_cast<Count>(internal::quartic_real_root_count<Real>(batch[i], epsilon));
+    }
+}
+
+/// smallest real root of each quartic, NaN if there is none; only the smaller root of each real pair is formed
+template <typename Real, typename Batch, typename Out>
+void quartic_min_real_roots(
+    const Batch& batch, Out* min_roots, const Real epsilon = std::numeric_limits<Real>::epsilon()
+) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto min_root = std::numeric_limits<Real>::infinity();
+        internal::visit_real_root_pairs<Real>(batch[i], epsilon, [&](const Real center, const Real half_width) {
+            const auto root = center - half_width;
+            min_root = (min_root < root) ? min_root : root;
+        });
+        min_roots[i] = (min_root != std::numeric_limits<Real>::infinity()) ? static_cast<Out>(min_root)
+                                                                            : internal::no_root<Out>();
+    }
+}
+
+/// largest real root of each quartic, NaN if there is none; only the larger root of each real pair is formed
+template <typename Real, typename Batch, typename Out>
+void quartic_max_real_roots(
+    const Batch& batch, Out* max_roots, const Real epsilon = std::numeric_limits<Real>::epsilon()
+) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto max_root = -std::numeric_limits<Real>::infinity();
+        internal::visit_real_root_pairs<Real>(batch[i], epsilon, [&](const Real center, const Real half_width) {
+            const auto root = center + half_width;
+            max_root = (max_root > root) ? max_root : root;
+        });
+        max_roots[i] = (max_root != -std::numeric_limits<Real>::infinity()) ? static_cast<Out>(max_root)
+                                                                             : internal::no_root<Out>();
+    }
+}
+
+/// smallest strictly positive real root of each quartic, NaN if there is none; the larger root of a real pair is only
+/// formed when the smaller one is not positive
+template <typename Real, typename Batch, typename Out>
+void quartic_min_positive_real_roots(
+    const Batch& batch, Out* min_roots, const Real epsilon = std::numeric_limits<Real>::epsilon()
+) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto min_root = std::numeric_limits<Real>::infinity();
+        internal::visit_real_root_pairs<Real>(batch[i], epsilon, [&](const Real center, const Real half_width) {
+            const auto lower = center - half_width;
+            const auto upper = center + half_width;
+            min_root = (lower > 0 && lower < min_root) ? lower : min_root;
+            min_root = (upper > 0 && upper < min_root) ? upper : min_root;
+        });
+        min_roots[i] = (min_root != std::numeric_limits<Real>::infinity()) ? static_cast<Out>(min_root)
+                                                                            : internal::no_root<Out>();
+    }
+}
+
+/// ascending real roots of each quartic; `roots[j][i]` is root j of polynomial i
+///
+/// Slots at and beyond `counts[i]` are left untouched.
+template <typename Real, typename Batch, typename Out, typename Count>
+void quartic_real_roots_sorted(
+    const Batch& batch,
+    const std::array<Out*, 4>& roots,
+    Count* counts,
+    const Real epsilon = std::numeric_limits<Real>::epsilon()
+) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto [real_roots, n_roots] = internal::quartic_real_roots<Real>(batch[i], epsilon);
+        dm::math::internal::sort_roots(real_roots, n_roots);
+        for (std::size_t j = 0; j < n_roots; ++j) {
+            roots[j][i] = static_cast<Out>(real_roots[j]);
+        }
+        counts[i] = static_cast<Count>(n_roots);
+    }
+}
+
+/// all four roots of each quartic as split real and imaginary arrays; `real[j][i]` is root j of polynomial i
+template <typename Real, typename Batch, typename Out>
+void quartic_roots(
+    const Batch& batch,
+    const std::array<Out*, 4>& real,
+    const std::array<Out*, 4>& imag,
+    const Real epsilon = std::numeric_limits<Real>::epsilon()
+) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto& c = batch[i];
+        const auto r =
+            dm::math::internal::MonicQuartic<Real>{c[0] / c[4], c[1] / c[4], c[2] / c[4], c[3] / c[4]}.roots(epsilon);
+        real[0][i] = static_cast<Out>(r.x1);
+        real[1][i] = static_cast<Out>(r.x2);
+        real[2][i] = static_cast<Out>(r.x3);
+        real[3][i] = static_cast<Out>(r.x4);
+        imag[0][i] = static_cast<Out>(r.y1);
+        imag[1][i] = static_cast<Out>(r.y2);
+        imag[2][i] = static_cast<Out>(r.y3);
+        imag[3][i] = static_cast<Out>(r.y4);
+    }
+}
+
+/// all three roots of each cubic as split real and imaginary arrays; `real[j][i]` is root j of polynomial i
+template <typename Real, typename Batch, typename Out>
+void cubic_roots(const Batch& batch, const std::array<Out*, 3>& real, const std::array<Out*, 3>& imag) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto& c = batch[i];
+        const auto r = dm::math::internal::MonicCubic<Real>{c[0] / c[3], c[1] / c[3], c[2] / c[3]}.roots();
+        real[0][i] = static_cast<Out>(r.x1);
+        real[1][i] = static_cast<Out>(r.x2);
+        real[2][i] = static_cast<Out>(r.x3);
+        imag[0][i] = static_cast<Out>(r.y1);
+        imag[1][i] = static_cast<Out>(r.y2);
+        imag[2][i] = static_cast<Out>(r.y3);
+    }
+}
+
+/// both roots of each quadratic as split real and imaginary arrays; `real[j][i]` is root j of polynomial i
+template <typename Real, typename Batch, typename Out>
+void quadratic_roots(const Batch& batch, const std::array<Out*, 2>& real, const std::array<Out*, 2>& imag) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto& c = batch[i];
+        const auto r = dm::math::internal::MonicQuadratic<Real>{c[0] / c[2], c[1] / c[2]}.roots();
+        real[0][i] = static_cast<Out>(r.x1);
+        real[1][i] = static_cast<Out>(r.x2);
+        imag[0][i] = static_cast<Out>(r.y1);
+        imag[1][i] = static_cast<Out>(-r.y1);
+    }
+}
+
+/// scratch space for `quartic_real_roots_by_degree`, reusable across calls to avoid reallocating
+template <typename Real>
+struct DegreeBuckets
+{
+    /// effective degree of each polynomial, in batch order
+    std::vector<std::uint8_t> degrees;
+    /// polynomial indices grouped by effective degree, in batch order within each group
+    std::vector<std::size_t> order;
+    /// order[offsets[d]] up to order[offsets[d + 1]] are the polynomials of effective degree d
+    std::array<std::size_t, 6> offsets;
+    /// monic[4 * b + k] = c[k] / c[d] for polynomial order[b] of degree d and k < d
+    std::vector<Real> monic;
+
+    [[nodiscard]] std::size_t size(const std::size_t degree) const noexcept
+    {
+        return offsets[degree + 1] - offsets[degree];
+    }
+};
+
+/// partitions `batch` by effective degree with a counting sort, see `internal::effective_degree` for `tolerance`
+template <typename Real, typename Batch>
+void bucket_by_degree(const Batch& batch, DegreeBuckets<Real>& buckets, const Real tolerance = 0)
+{
+    const auto n = std::size(batch);
+    buckets.degrees.resize(n);
+    buckets.order.resize(n);
+    buckets.monic.resize(4 * n);
+
+    std::array<std::size_t, 5> sizes{};
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto degree = internal::effective_degree<Real, 5>(batch[i], tolerance);
+        buckets.degrees[i] = static_cast<std::uint8_t>(degree);
+        ++sizes[degree];
+    }
+    buckets.offsets[0] = 0;
+    for (std::size_t d = 0; d < 5; ++d) {
+        buckets.offsets[d + 1] = buckets.offsets[d] + sizes[d];
+    }
+
+    auto next = buckets.offsets;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto& c = batch[i];
+        const auto degree = buckets.degrees[i];
+        const auto b = next[degree]++;
+        buckets.order[b] = i;
+        // all four slots are written so the loop does not depend on the degree; those at and beyond it are unused
+        const auto leading = static_cast<Real>(c[degree]);
+        for (std::size_t k = 0; k < 4; ++k) {
+            buckets.monic[4 * b + k] = static_cast<Real>(c[k]) / leading;
+        }
+    }
+}
+
+/// real roots of each quartic like `dm::math::quartic_real_roots`, but with vanishing leading coefficients handled by
+/// degree instead of per element: the batch is partitioned into buckets of equal effective degree, each bucket is
+/// solved by a loop over the monic solver of its degree, and the roots are scattered back so that `roots[j][i]` is
+/// root j of polynomial i
+///
+/// The bucket loops run faster than the per-element fallback, but partitioning costs about as much as they save;
+/// DegreeBucketsBenchmark measures both. Reusing `buckets` across calls avoids reallocating them.
+///
+/// With `tolerance = 0` only exactly-zero leading coefficients lower the degree and the roots match
+/// `quartic_real_roots`. Slots at and beyond `counts[i]` are left untouched.
+template <typename Real, typename Batch, typename Out, typename Count>
+void quartic_real_roots_by_degree(
+    const Batch& batch,
+    const std::array<Out*, 4>& roots,
+    Count* counts,
+    DegreeBuckets<Real>& buckets,
+    const Real tolerance = 0,
+    const Real epsilon = std::numeric_limits<Real>::epsilon()
+)
+{
+    bucket_by_degree<Real>(batch, buckets, tolerance);
+
+    const auto& order = buckets.order;
+    const auto& offsets = buckets.offsets;
+    const auto* m = buckets.monic.data();
+    const auto scatter = [&](const std::size_t b, const auto& real_roots, const std::size_t n_roots) noexcept {
+        const auto i = order[b];
+        for (std::size_t j = 0; j < n_roots; ++j) {
+            roots[j][i] = static_cast<Out>(real_roots[j]);
+        }
+        counts[i] = static_cast<Count>(n_roots);
+    };
+
+    for (auto b = offsets[0]; b < offsets[1]; ++b) {
+        counts[order[b]] = 0;
+    }
+    for (auto b = offsets[1]; b < offsets[2]; ++b) {
+        scatter(b, std::array<Real, 1>{-m[4 * b]}, 1);
+    }
+    for (auto b = offsets[2]; b < offsets[3]; ++b) {
+        const auto [real_roots, n_roots] =
+            dm::math::internal::MonicQuadratic<Real>{m[4 * b], m[4 * b + 1]}.real_roots().to_array();
+        scatter(b, real_roots, n_roots);
+    }
+    for (auto b = offsets[3]; b < offsets[4]; ++b) {
+        const auto [real_roots, n_roots] =
+            dm::math::internal::MonicCubic<Real>{m[4 * b], m[4 * b + 1], m[4 * b + 2]}.real_roots().to_array();
+        scatter(b, real_roots, n_roots);
+    }
+    for (auto b = offsets[4]; b < offsets[5]; ++b) {
+        const auto [real_roots, n_roots] =
+            dm::math::internal::MonicQuartic<Real>{m[4 * b], m[4 * b + 1], m[4 * b + 2], m[4 * b + 3]}
+                .real_roots(epsilon)
+                .to_array();
+        scatter(b, real_roots, n_roots);
+    }
+}
+
+template <typename Real, typename Batch, typename Out, typename Count>
+void quartic_real_roots_by_degree(
+    const Batch& batch,
+    const std::array<Out*, 4>& roots,
+    Count* counts,
+    const Real tolerance = 0,
+    const Real epsilon = std::numeric_limits<Real>::epsilon()
+)
+{
+    DegreeBuckets<Real> buckets;
+    quartic_real_roots_by_degree<Real>(batch, roots, counts, buckets, tolerance, epsilon);
+}
+
+} // namespace dm::math::batch
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "cubic_roots.hpp"
+#include "quartic_roots.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace dm::math {
+
+// Polynomials in Bernstein form on [0, 1]: p(t) = sum_i b[i] * C(N, i) * t^i * (1 - t)^(N - i), as used for the
+// segments of Bezier curves and B-splines. Only roots in [0, 1] are reported.
+
+namespace internal {
+
+[[nodiscard]] constexpr double binomial(const std::size_t n, const std::size_t k) noexcept
+{
+    double result = 1;
+    for (std::size_t i = 1; i <= k; ++i) {
+        result = result * static_cast<double>(n - k + i) / static_cast<double>(i);
+    }
+    return result;
+}
+
+/// number of sign changes in the control polygon, an upper bound on the number of roots in (0, 1)
+template <typename Real, std::size_t N>
+[[nodiscard]] std::size_t sign_variations(const std::array<Real, N>& b) noexcept
+{
+    std::size_t variations = 0;
+    int previous_sign = 0;
+    for (const auto value : b) {
+        const int sign = (value > 0) - (value < 0);
+        if (sign != 0) {
+            variations += (previous_sign != 0 && sign != previous_sign);
+            previous_sign = sign;
+        }
+    }
+    return variations;
+}
+
+/// true when the control polygon rules out any root on [0, 1]
+template <typename Real, std::size_t N>
+[[nodiscard]] bool bernstein_root_free(const std::array<Real, N>& b) noexcept
+{
+    return b.front() != 0 && b.back() != 0 && sign_variations(b) == 0;
+}
+
+/// power-basis coefficients, lowest degree first: a[k] = C(N, k) * sum_i (-1)^(k - i) * C(k, i) * b[i]
+template <typename Real, std::size_t N>
+[[nodiscard]] std::array<Real, N> bernstein_to_power(const std::array<Real, N>& b) noexcept
+{
+    constexpr auto degree = N - 1;
+    std::array<Real, N> a{};
+    for (std::size_t k = 0; k <= degree; ++k) {
+        Real sum = 0;
+        for (std::size_t i = 0; i <= k; ++i) {
+            const auto term = static_cast<Real>(binomial(k, i)) * b[i];
+            sum += ((k - i) % 2 == 0) ? term : -term;
+        }
+        a[k] = static_cast<Real>(binomial(degree, k)) * sum;
+    }
+    return a;
+}
+
+/// value and derivative at `t` by de Casteljau's algorithm, which stays accurate on [0, 1]
+template <typename Real, std::size_t N>
+[[nodiscard]] std::pair<Real, Real> bernstein_evaluate(std::array<Real, N> b, const Real t) noexcept
+{
+    constexpr auto degree = N - 1;
+    for (std::size_t level = degree; level > 1; --level) {
+        for (std::size_t i = 0; i < level; ++i) {
+            b[i] = (1 - t) * b[i] + t * b[i + 1];
+        }
+    }
+    return {(1 - t) * b[0] + t * b[1], degree * (b[1] - b[0])};
+}
+
+/// Newton steps in Bernstein form, kept only while they reduce the residual and stay on [0, 1]
+template <typename Real, std::size_t N>
+[[nodiscard]] Real polish_bernstein_root(const std::array<Real, N>& b, Real t) noexcept
+{
+    using std::abs;
+    auto [value, slope] = bernstein_evaluate(b, t);
+    for (int iteration = 0; iteration < 2 && value != 0 && slope != 0; ++iteration) {
+        const auto next = t - value / slope;
+        if (next < 0 || next > 1) {
+            break;
+        }
+        const auto [next_value, next_slope] = bernstein_evaluate(b, next);
+        if (!(abs(next_value) < abs(value))) {
+            break;
+        }
+        t = next;
+        value = next_value;
+        slope = next_slope;
+    }
+    return t;
+}
+
+template <typename Real, std::size_t N>
+[[nodiscard]] std::pair<std::array<Real, N - 1>, std::size_t> bernstein_unit_roots(const std::array<Real, N>& b
+) noexcept
+{
+    static_assert(N == 4 || N == 5, "Bernstein roots are implemented for cubics and quartics");
+
+    std::array<Real, N - 1> unit_roots{};
+    std::size_t n_unit_roots = 0;
+    if (bernstein_root_free(b)) {
+        return {unit_roots, 0};
+    }
+
+    const auto a = bernstein_to_power(b);
+    const auto [roots, n_roots] = [&a] {
+        if constexpr (N == 4) {
+            return cubic_real_roots<Real>(a);
+        } else {
+            return quartic_real_roots<Real>(a);
+        }
+    }();
+
+    // closed-form roots of a segment that just touches an end point can land a few ulps outside the interval
+    const auto slack = 64 * std::numeric_limits<Real>::epsilon();
+    for (std::size_t i = 0; i < n_roots; ++i) {
+        auto t = roots[i];
+        if (t < -slack || t > 1 + slack) {
+            continue;
+        }
+        t = (t < 0) ? Real{0} : (t > 1) ? Real{1} : t;
+        unit_roots[n_unit_roots++] = polish_bernstein_root(b, t);
+    }
+    sort_roots(unit_roots, n_unit_roots);
+    return {unit_roots, n_unit_roots};
+}
+
+} // namespace internal
+
+/// ascending roots on [0, 1] of the cubic with Bernstein coefficients `b`
+template <typename Real>
+[[nodiscard]] std::pair<std::array<Real, 3>, std::size_t> cubic_bernstein_roots(const std::array<Real, 4>& b) noexcept
+{
+    return internal::bernstein_unit_roots(b);
+}
+
+/// ascending roots on [0, 1] of the quartic with Bernstein coefficients `b`
+template <typename Real>
+[[nodiscard]] std::pair<std::array<Real, 4>, std::size_t> quartic_bernstein_roots(const std::array<Real, 5>& b
+) noexcept
+{
+    return internal::bernstein_unit_roots(b);
+}
+
+namespace batch {
+
+/// Roots on [0, 1] of `n` polynomials of degree `N - 1` whose Bernstein coefficient i is `b[i][segment]`.
+///
+/// Root j of a segment is written to `roots[j][segment]` in ascending order and the number of roots to
+/// `counts[segment]`; slots at and beyond the count are left untouched. A first pass uses only sign tests on the
+/// control polygons to discard root-free segments, so the closed-form solver runs on the survivors alone.
+template <typename Real, std::size_t N, typename Out, typename Count>
+void bernstein_roots(
+    const std::array<const Real*, N>& b, const std::size_t n, const std::array<Out*, N - 1>& roots, Count* counts
+)
+{
+    std::vector<std::size_t> candidates;
+    candidates.reserve(n);
+    for (std::size_t segment = 0; segment < n; ++segment) {
+        bool root_free = true;
+        const auto first = b[0][segment];
+        const auto last = b[N - 1][segment];
+        if (first == 0 || last == 0) {
+            root_free = false;
+        }
+        for (std::size_t i = 1; i < N && root_free; ++i) {
+            root_free = (b[i][segment] > 0) == (first > 0) && b[i][segment] != 0;
+        }
+        if (root_free) {
+            counts[segment] = 0;
+        } else {
+            candidates.push_back(segment);
+        }
+    }
+
+    for (const auto segment : candidates) {
+        std::array<Real, N> control;
+        for (std::size_t i = 0; i < N; ++i) {
+            control[i] = b[i][segment];
+        }
+        const auto [unit_roots, n_unit_roots] = dm::math::internal::bernstein_unit_roots(control);
+        for (std::size_t j = 0; j < n_unit_roots; ++j) {
+            roots[j][segment] = static_cast<Out>(unit_roots[j]);
+        }
+        counts[segment] = static_cast<Count>(n_unit_roots);
+    }
+}
+
+/// roots on [0, 1] of `n` cubic segments in Bernstein form; see `bernstein_roots`
+template <typename Real, typename Out, typename Count>
+void cubic_bernstein_roots(
+    const std::array<const Real*, 4>& b, const std::size_t n, const std::array<Out*, 3>& roots, Count* counts
+)
+{
+    bernstein_roots<Real, 4>(b, n, roots, counts);
+}
+
+/// roots on [0, 1] of `n` quartic segments in Bernstein form; see `bernstein_roots`
+template <typename Real, typename Out, typename Count>
+void quartic_bernstein_roots(
+    const std::array<const Real*, 5>& b, const std::size_t n, const std::array<Out*, 4>& roots, Count* counts
+)
+{
+    bernstein_roots<Real, 5>(b, n, roots, counts);
+}
+
+} // namespace batch
+
+} // namespace dm::math
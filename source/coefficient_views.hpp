@@ -0,0 +1,178 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace dm::math::batch {
+
+// Views that present coefficients already in the caller's memory as a `Batch` (`batch[i][k]` is coefficient k of
+// polynomial i, lowest degree first), so that the batch functions and, through `batch[i]`, the scalar solvers read
+// them in place. `batch[i]` gathers the N coefficients of polynomial i into a `std::array` with one load each, lowest
+// degree first (in increasing address order only when the coefficient stride is positive), so the solver works on
+// registers rather than re-reading strided memory and the scalar calls match the explicit instantiations for
+// `std::array`.
+
+/// Coefficient k of polynomial i at byte offset `i * polynomial_stride + k * coefficient_stride` from `first`. Strides
+/// are in bytes so that coefficients can be members of arbitrary structs; they may be negative.
+template <typename Value, std::size_t N>
+class StridedRows
+{
+  public:
+    StridedRows(
+        const Value* first,
+        const std::size_t n,
+        const std::ptrdiff_t polynomial_stride,
+        const std::ptrdiff_t coefficient_stride = sizeof(Value)
+    ) noexcept
+        : first_(reinterpret_cast<const unsigned char*>(first)),
+          n_(n),
+          polynomial_stride_(polynomial_stride),
+          coefficient_stride_(coefficient_stride)
+    {
+    }
+
+    [[nodiscard]] std::array<Value, N> operator[](const std::size_t i) const noexcept
+    {
+        const auto* polynomial = first_ + static_cast<std::ptrdiff_t>(i) * polynomial_stride_;
+        std::array<Value, N> c;
+        for (std::size_t k = 0; k < N; ++k) {
+            c[k] = *reinterpret_cast<const Value*>(polynomial + static_cast<std::ptrdiff_t>(k) * coefficient_stride_);
+        }
+        return c;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return n_;
+    }
+
+  private:
+    const unsigned char* first_;
+    std::size_t n_;
+    std::ptrdiff_t polynomial_stride_;
+    std::ptrdiff_t coefficient_stride_;
+};
+
+/// coefficients stored as the array member `coefficients` of each of `n` consecutive structs
+template <typename Struct, typename Value, std::size_t N>
+[[nodiscard]] StridedRows<Value, N>
+member_rows(const Struct* structs, const std::size_t n, Value (Struct::*coefficients)[N]) noexcept
+{
+    if (n == 0) {
+        return {nullptr, 0, 0};
+    }
+    return {structs->*coefficients, n, static_cast<std::ptrdiff_t>(sizeof(Struct))};
+}
+
+/// n x N row-major matrix, one polynomial per row, rows `leading_dimension` elements apart
+template <std::size_t N, typename Value>
+[[nodiscard]] StridedRows<Value, N>
+row_major_rows(const Value* matrix, const std::size_t n, const std::size_t leading_dimension = N) noexcept
+{
+    return {matrix, n, static_cast<std::ptrdiff_t>(leading_dimension * sizeof(Value))};
+}
+
+/// n x N column-major matrix, one polynomial per row, columns `leading_dimension` elements apart (BLAS/LAPACK layout)
+template <std::size_t N, typename Value>
+[[nodiscard]] StridedRows<Value, N>
+column_major_rows(const Value* matrix, const std::size_t n, const std::size_t leading_dimension) noexcept
+{
+    return {
+        matrix,
+        n,
+        static_cast<std::ptrdiff_t>(sizeof(Value)),
+        static_cast<std::ptrdiff_t>(leading_dimension * sizeof(Value)),
+    };
+}
+
+/// structure of arrays: coefficient k of polynomial i is `columns[k][i]`, with each column anywhere in memory
+template <typename Value, std::size_t N>
+class SoARows
+{
+  public:
+    SoARows(const std::array<const Value*, N>& columns, const std::size_t n) noexcept : columns_(columns), n_(n) {}
+
+    [[nodiscard]] std::array<Value, N> operator[](const std::size_t i) const noexcept
+    {
+        std::array<Value, N> c;
+        for (std::size_t k = 0; k < N; ++k) {
+            c[k] = columns_[k][i];
+        }
+        return c;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return n_;
+    }
+
+  private:
+    std::array<const Value*, N> columns_;
+    std::size_t n_;
+};
+
+namespace internal {
+
+/// `Mdspan::static_extent(1)` where the type provides it, otherwise the `dynamic_extent` value
+template <typename Mdspan, typename = void>
+inline constexpr std::size_t static_column_extent = std::numeric_limits<std::size_t>::max();
+
+template <typename Mdspan>
+inline constexpr std::size_t
+    static_column_extent<Mdspan, std::void_t<decltype(Mdspan::static_extent(1))>> = Mdspan::static_extent(1);
+
+} // namespace internal
+
+/// Rows of a rank-2 `std::mdspan`, or any type with `extent(0)` and element access `m[i, k]` (C++23) or `m(i, k)`
+/// such as the Kokkos reference implementation, whose second extent is N. Works with every layout, including
+/// `layout_stride`, and leaves the index arithmetic to the mapping. A static second extent other than N fails to
+/// compile, and a dynamic one is checked by an assertion.
+template <std::size_t N, typename Mdspan>
+class MdspanRows
+{
+    static_assert(
+        internal::static_column_extent<Mdspan> == std::numeric_limits<std::size_t>::max() ||
+            internal::static_column_extent<Mdspan> == N,
+        "the mdspan must have one column per coefficient"
+    );
+
+  public:
+    using Value = typename Mdspan::value_type;
+
+    explicit MdspanRows(const Mdspan& coefficients) noexcept : coefficients_(coefficients)
+    {
+        assert(static_cast<std::size_t>(coefficients_.extent(1)) == N && "one column per coefficient");
+    }
+
+    [[nodiscard]] std::array<Value, N> operator[](const std::size_t i) const noexcept
+    {
+        std::array<Value, N> c;
+        for (std::size_t k = 0; k < N; ++k) {
+#if defined(__cpp_multidimensional_subscript)
+            c[k] = coefficients_[i, k];
+#else
+            c[k] = coefficients_(i, k);
+#endif
+        }
+        return c;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>(coefficients_.extent(0));
+    }
+
+  private:
+    Mdspan coefficients_;
+};
+
+template <std::size_t N, typename Mdspan>
+[[nodiscard]] MdspanRows<N, Mdspan> mdspan_rows(const Mdspan& coefficients) noexcept
+{
+    return MdspanRows<N, Mdspan>{coefficients};
+}
+
+} // namespace dm::math::batch
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace dm::math {
+
+// Compact coefficient storage for batches that are limited by memory bandwidth rather than arithmetic. Coefficients
+// are kept as 16-bit floats or as integer mantissas sharing one exponent per block of polynomials, and the row views
+// below widen them to `Real` as the solver reads each coefficient, so the batch functions work on them unchanged.
+
+namespace internal {
+
+template <typename To, typename From>
+[[nodiscard]] To bit_cast(const From& from) noexcept
+{
+    static_assert(sizeof(To) == sizeof(From));
+    To to;
+    std::memcpy(&to, &from, sizeof(To));
+    return to;
+}
+
+} // namespace internal
+
+/// IEEE 754 binary16: 11 significant bits, finite range up to 65504; uses the F16C instructions when compiled for them
+struct Half
+{
+    std::uint16_t bits;
+
+    /// rounds to nearest, ties to even; overflows to infinity and keeps NaN a NaN
+    [[nodiscard]] static Half from_float(const float value) noexcept
+    {
+#if defined(__F16C__)
+        return {_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT)};
+#else
+        const auto bits = internal::bit_cast<std::uint32_t>(value);
+        const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+        const auto magnitude = bits & 0x7fffffffu;
+        if (magnitude >= 0x7f800000u) {
+            const auto payload = (magnitude > 0x7f800000u) ? (0x200u | ((magnitude >> 13) & 0x3ffu)) : 0u;
+            return {static_cast<std::uint16_t>(sign | 0x7c00u | payload)};
+        }
+        if (magnitude >= 0x477ff000u) {
+            // at or above the midpoint between 65504 and 65536
+            return {static_cast<std::uint16_t>(sign | 0x7c00u)};
+        }
+        if (magnitude < 0x38800000u) {
+            // below 2^-14: subnormal, and zero below half the smallest subnormal 2^-24
+            if (magnitude < 0x33000000u) {
+                return {sign};
+            }
+            const auto shift = 126u - (magnitude >> 23);
+            const auto significand = (magnitude & 0x7fffffu) | 0x800000u;
+            return {static_cast<std::uint16_t>(sign | round_shifted(significand, shift))};
+        }
+        // a carry out of the significand correctly bumps the exponent
+        return {static_cast<std::uint16_t>(sign | round_shifted(magnitude - (112u << 23), 13))};
+#endif
+    }
+
+    [[nodiscard]] float to_float() const noexcept
+    {
+#if defined(__F16C__)
+        return _cvtsh_ss(bits);
+#else
+        const auto sign = static_cast<std::uint32_t>(bits & 0x8000u) << 16;
+        const auto exponent = (bits >> 10) & 0x1fu;
+        const auto significand = static_cast<std::uint32_t>(bits & 0x3ffu);
+        if (exponent == 0x1f) {
+            return internal::bit_cast<float>(sign | 0x7f800000u | (significand << 13));
+        }
+        if (exponent == 0) {
+            const auto value = static_cast<float>(significand) * 5.9604644775390625e-08f; // 2^-24
+            return (sign != 0) ? -value : value;
+        }
+        return internal::bit_cast<float>(sign | ((exponent + 112u) << 23) | (significand << 13));
+#endif
+    }
+
+  private:
+    [[nodiscard]] static std::uint32_t round_shifted(const std::uint32_t value, const std::uint32_t shift) noexcept
+    {
+        const auto kept = value >> shift;
+        const auto remainder = value & ((1u << shift) - 1);
+        const auto halfway = 1u << (shift - 1);
+        return kept + ((remainder > halfway || (remainder == halfway && (kept & 1u) != 0)) ? 1u : 0u);
+    }
+};
+
+/// bfloat16: the upper half of a binary32, 8 significant bits with the full float range
+struct BFloat16
+{
+    std::uint16_t bits;
+
+    /// rounds to nearest, ties to even, and keeps NaN a NaN
+    [[nodiscard]] static BFloat16 from_float(const float value) noexcept
+    {
+        const auto bits = internal::bit_cast<std::uint32_t>(value);
+        if ((bits & 0x7fffffffu) > 0x7f800000u) {
+            return {static_cast<std::uint16_t>((bits >> 16) | 0x40u)};
+        }
+        return {static_cast<std::uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16)};
+    }
+
+    [[nodiscard]] float to_float() const noexcept
+    {
+        return internal::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16);
+    }
+};
+
+/// `values` rounded to `Storage` (`Half` or `BFloat16`), through float
+template <typename Storage>
+[[nodiscard]] std::vector<Storage> encode(const double* values, const std::size_t count)
+{
+    std::vector<Storage> encoded(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        encoded[i] = Storage::from_float(static_cast<float>(values[i]));
+    }
+    return encoded;
+}
+
+/// integer mantissas with one power-of-two exponent per block of `block_size` polynomials: coefficient k of
+/// polynomial i is `mantissas[n_coefficients * i + k] * 2^exponents[i / block_size]`
+template <typename Int>
+struct BlockScaledCoefficients
+{
+    std::size_t n_coefficients;
+    std::size_t block_size;
+    std::vector<Int> mantissas;
+    std::vector<std::int16_t> exponents;
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return mantissas.size() / n_coefficients;
+    }
+};
+
+/// Quantizes `n` polynomials of `n_coefficients` coefficients each (`coefficients[n_coefficients * i + k]`), choosing
+/// each block's exponent so that its largest coefficient uses the full mantissa width. Roots are invariant under a
+/// common scale, so one polynomial per block (the default) loses nothing to the shared exponent beyond mantissa
+/// rounding; larger blocks trade precision of small polynomials for fewer exponents. Throws std::invalid_argument if a
+/// coefficient is infinite or NaN, which no exponent can represent.
+template <typename Int>
+[[nodiscard]] BlockScaledCoefficients<Int> quantize_block_scaled(
+    const double* coefficients, const std::size_t n, const std::size_t n_coefficients, const std::size_t block_size = 1
+)
+{
+    static_assert(std::numeric_limits<Int>::is_integer && std::numeric_limits<Int>::is_signed);
+    constexpr auto digits = std::numeric_limits<Int>::digits;
+    constexpr auto max_mantissa = static_cast<double>(std::numeric_limits<Int>::max());
+
+    BlockScaledCoefficients<Int> quantized{n_coefficients, std::max<std::size_t>(block_size, 1), {}, {}};
+    quantized.mantissas.resize(n * n_coefficients);
+    quantized.exponents.resize((n + quantized.block_size - 1) / quantized.block_size);
+    for (std::size_t block = 0; block < quantized.exponents.size(); ++block) {
+        const auto begin = block * quantized.block_size * n_coefficients;
+        const auto end = std::min(n, (block + 1) * quantized.block_size) * n_coefficients;
+        double largest = 0;
+        for (auto k = begin; k < end; ++k) {
+            if (!std::isfinite(coefficients[k])) {
+                throw std::invalid_argument("quantize_block_scaled: coefficients must be finite");
+            }
+            largest = std::max(largest, std::abs(coefficients[k]));
+        }
+        int exponent = 0;
+        if (largest > 0) {
+            std::frexp(largest, &exponent);
+            exponent -= digits;
+        }
+        quantized.exponents[block] = static_cast<std::int16_t>(exponent);
+        for (auto k = begin; k < end; ++k) {
+            const auto mantissa = std::nearbyint(std::ldexp(coefficients[k], -exponent));
+            quantized.mantissas[k] = static_cast<Int>(std::clamp(mantissa, -max_mantissa, max_mantissa));
+        }
+    }
+    return quantized;
+}
+
+namespace batch {
+
+/// `batch[i][k]` view of `Half` or `BFloat16` coefficients, `N` per polynomial, widened to `Real` on access
+template <typename Real, std::size_t N, typename Storage>
+class CompactRows
+{
+  public:
+    struct Row
+    {
+        const Storage* coefficients;
+
+        [[nodiscard]] Real operator[](const std::size_t k) const noexcept
+        {
+            return static_cast<Real>(coefficients[k].to_float());
+        }
+    };
+
+    CompactRows(const Storage* coefficients, const std::size_t n) noexcept : coefficients_(coefficients), n_(n) {}
+
+    [[nodiscard]] Row operator[](const std::size_t i) const noexcept
+    {
+        return {coefficients_ + N * i};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return n_;
+    }
+
+  private:
+    const Storage* coefficients_;
+    std::size_t n_;
+};
+
+/// `batch[i][k]` view of `BlockScaledCoefficients` with `N` coefficients per polynomial, widened to `Real` on access
+template <typename Real, std::size_t N, typename Int>
+class BlockScaledRows
+{
+  public:
+    struct Row
+    {
+        const Int* mantissas;
+        Real scale;
+
+        [[nodiscard]] Real operator[](const std::size_t k) const noexcept
+        {
+            return static_cast<Real>(mantissas[k]) * scale;
+        }
+    };
+
+    explicit BlockScaledRows(const BlockScaledCoefficients<Int>& coefficients) noexcept : coefficients_(&coefficients) {}
+
+    [[nodiscard]] Row operator[](const std::size_t i) const noexcept
+    {
+        const auto exponent = coefficients_->exponents[i / coefficients_->block_size];
+        return {coefficients_->mantissas.data() + N * i, std::ldexp(Real{1}, exponent)};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return coefficients_->size();
+    }
+
+  private:
+    const BlockScaledCoefficients<Int>* coefficients_;
+};
+
+} // namespace batch
+
+} // namespace dm::math
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iterator>
+
+namespace dm::math {
+
+// Roots of polynomials with complex coefficients by the same closed-form pipelines as the real solvers: the quadratic
+// formula, Cardano's formula for the depressed cubic and Ferrari's resolvent cubic for the depressed quartic. With
+// complex coefficients there are no real/complex cases to tell apart, so each pipeline is a single branch-free path
+// apart from the degenerate zero checks, and the trigonometric form of the cubic, which only serves real coefficients
+// with three real roots, is not needed. Coefficients are lowest degree first and the leading one must be non-zero.
+
+namespace internal {
+
+/// principal cube root; std::pow(z, 1/3) is slower and loses accuracy near the negative real axis
+template <typename Real>
+[[nodiscard]] std::complex<Real> complex_cbrt(const std::complex<Real>& z) noexcept
+{
+    return std::polar(std::cbrt(std::abs(z)), std::arg(z) / 3);
+}
+
+template <typename Real>
+struct MonicComplexQuadratic
+{
+    using Complex = std::complex<Real>;
+
+    /// z^2 + c[1]*z + c[0]
+    std::array<Complex, 2> c;
+
+    [[nodiscard]] std::array<Complex, 2> roots() const noexcept
+    {
+        const auto d = std::sqrt(c[1] * c[1] - Real{4} * c[0]);
+        // the sign that avoids cancellation between -c[1] and d; the other root follows from the product c[0]
+        const auto q = (std::real(std::conj(c[1]) * d) >= 0) ? -(c[1] + d) / Real{2} : -(c[1] - d) / Real{2};
+        if (q == Complex{}) {
+            return {Complex{}, Complex{}};
+        }
+        return {q, c[0] / q};
+    }
+};
+
+template <typename Real>
+struct MonicComplexCubic
+{
+    using Complex = std::complex<Real>;
+
+    /// z^3 + a[2]*z^2 + a[1]*z + a[0]
+    std::array<Complex, 3> a;
+
+    [[nodiscard]] std::array<Complex, 3> roots() const noexcept
+    {
+        // z = t - a[2]/3 gives t^3 + p*t + q
+        const auto shift = a[2] / Real{3};
+        const auto p = a[1] - a[2] * shift;
+        const auto q = a[0] - a[1] * shift + Real{2} * shift * shift * shift;
+
+        const auto s = std::sqrt(q * q / Real{4} + p * p * p / Real{27});
+        const auto w = (std::real(std::conj(q) * s) >= 0) ? -q / Real{2} - s : -q / Real{2} + s;
+        const auto u = complex_cbrt(w);
+        if (u == Complex{}) {
+            return {-shift, -shift, -shift};
+        }
+        const auto v = -p / (Real{3} * u);
+        // the other cube roots of w are u * omega and u * conj(omega), with omega = (-1 + i sqrt(3)) / 2
+        const auto half_sum = -(u + v) / Real{2};
+        const auto half_difference = Complex{0, std::sqrt(Real{3}) / 2} * (u - v);
+        return {u + v - shift, half_sum + half_difference - shift, half_sum - half_difference - shift};
+    }
+};
+
+template <typename Real>
+struct MonicComplexQuartic
+{
+    using Complex = std::complex<Real>;
+
+    /// z^4 + A[3]*z^3 + A[2]*z^2 + A[1]*z + A[0]
+    std::array<Complex, 4> A;
+
+    [[nodiscard]] std::array<Complex, 4> roots() const noexcept
+    {
+        // z = y - A[3]/4 gives y^4 + p*y^2 + q*y + r
+        const auto shift = A[3] / Real{4};
+        const auto shift2 = shift * shift;
+        const auto p = A[2] - Real{6} * shift2;
+        const auto q = A[1] - Real{2} * A[2] * shift + Real{8} * shift2 * shift;
+        const auto r = A[0] - A[1] * shift + A[2] * shift2 - Real{3} * shift2 * shift2;
+
+        std::array<Complex, 4> roots;
+        if (q == Complex{}) {
+            // y^4 + p*y^2 + r is a quadratic in y^2
+            const auto w = MonicComplexQuadratic<Real>{{r, p}}.roots();
+            roots = {std::sqrt(w[0]), -std::sqrt(w[0]), std::sqrt(w[1]), -std::sqrt(w[1])};
+        } else {
+            // y^4 + p*y^2 + q*y + r = (y^2 + s*y + p/2 + m - q/(2s)) (y^2 - s*y + p/2 + m + q/(2s)) with s^2 = 2m,
+            // for any root m of the resolvent m^3 + p*m^2 + (p^2/4 - r)*m - q^2/8, none of which is 0 as q != 0; the
+            // largest keeps s and q/(2s) well scaled
+            const auto resolvent = MonicComplexCubic<Real>{{-q * q / Real{8}, p * p / Real{4} - r, p}}.roots();
+            auto m = resolvent[0];
+            for (const auto& candidate : resolvent) {
+                if (std::norm(candidate) > std::norm(m)) {
+                    m = candidate;
+                }
+            }
+            const auto s = std::sqrt(Real{2} * m);
+            const auto mean = p / Real{2} + m;
+            const auto offset = q / (Real{2} * s);
+            const auto first = MonicComplexQuadratic<Real>{{mean - offset, s}}.roots();
+            const auto second = MonicComplexQuadratic<Real>{{mean + offset, -s}}.roots();
+            roots = {first[0], first[1], second[0], second[1]};
+        }
+        for (auto& root : roots) {
+            root -= shift;
+        }
+        return roots;
+    }
+};
+
+} // namespace internal
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] std::array<std::complex<Real>, 2> complex_quadratic_roots(const Coefficients& c) noexcept
+{
+    const std::complex<Real> leading = c[2];
+    return internal::MonicComplexQuadratic<Real>{{c[0] / leading, c[1] / leading}}.roots();
+}
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] std::array<std::complex<Real>, 3> complex_cubic_roots(const Coefficients& c) noexcept
+{
+    const std::complex<Real> leading = c[3];
+    return internal::MonicComplexCubic<Real>{{c[0] / leading, c[1] / leading, c[2] / leading}}.roots();
+}
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] std::array<std::complex<Real>, 4> complex_quartic_roots(const Coefficients& c) noexcept
+{
+    const std::complex<Real> leading = c[4];
+    return internal::MonicComplexQuartic<Real>{{c[0] / leading, c[1] / leading, c[2] / leading, c[3] / leading}}
+        .roots();
+}
+
+namespace batch {
+
+// Batch forms over any `Batch` of complex coefficients (`batch[i][k]` convertible to `std::complex<Real>`), with the
+// roots written as split real and imaginary arrays like `batch::quartic_roots`: `real[j][i]` is root j of polynomial i.
+
+template <typename Real, typename Batch, typename Out>
+void complex_quadratic_roots(
+    const Batch& batch, const std::array<Out*, 2>& real, const std::array<Out*, 2>& imag
+) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto roots = dm::math::complex_quadratic_roots<Real>(batch[i]);
+        for (std::size_t j = 0; j < 2; ++j) {
+            real[j][i] = static_cast<Out>(roots[j].real());
+            imag[j][i] = static_cast<Out>(roots[j].imag());
+        }
+    }
+}
+
+template <typename Real, typename Batch, typename Out>
+void complex_cubic_roots(const Batch& batch, const std::array<Out*, 3>& real, const std::array<Out*, 3>& imag) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto roots = dm::math::complex_cubic_roots<Real>(batch[i]);
+        for (std::size_t j = 0; j < 3; ++j) {
+            real[j][i] = static_cast<Out>(roots[j].real());
+            imag[j][i] = static_cast<Out>(roots[j].imag());
+        }
+    }
+}
+
+template <typename Real, typename Batch, typename Out>
+void complex_quartic_roots(
+    const Batch& batch, const std::array<Out*, 4>& real, const std::array<Out*, 4>& imag
+) noexcept
+{
+    const auto n = std::size(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto roots = dm::math::complex_quartic_roots<Real>(batch[i]);
+        for (std::size_t j = 0; j < 4; ++j) {
+            real[j][i] = static_cast<Out>(roots[j].real());
+            imag[j][i] = static_cast<Out>(roots[j].imag());
+        }
+    }
+}
+
+} // namespace batch
+
+} // namespace dm::math
@@ -0,0 +1,588 @@
+#pragma once
+
+#include "batch_roots.hpp"
+#include "quartic_roots.hpp"
+#include "small_integral_powers.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace dm::math {
+
+template <typename RealT>
+struct Conic
+{
+    using Real = RealT;
+
+    /// a*x^2 + b*x*y + c*y^2 + d*x + e*y + f
+    Real a;
+    Real b;
+    Real c;
+    Real d;
+    Real e;
+    Real f;
+
+    [[nodiscard]] Real operator()(const Real x, const Real y) const noexcept
+    {
+        return a * x * x + b * x * y + c * y * y + d * x + e * y + f;
+    }
+
+    /// sum of the magnitudes of the terms of the conic at (x, y), the scale for residual checks
+    [[nodiscard]] Real magnitude(const Real x, const Real y) const noexcept
+    {
+        using std::abs;
+        return abs(a * x * x) + abs(b * x * y) + abs(c * y * y) + abs(d * x) + abs(e * y) + abs(f);
+    }
+
+    /// the same curve in coordinates shifted so that (x0, y0) becomes the origin
+    [[nodiscard]] Conic translated(const Real x0, const Real y0) const noexcept
+    {
+        return {a, b, c, d + 2 * a * x0 + b * y0, e + b * x0 + 2 * c * y0, (*this)(x0, y0)};
+    }
+};
+
+template <typename RealT>
+struct Ellipse
+{
+    using Real = RealT;
+
+    Real center_x;
+    Real center_y;
+    Real radius_x;
+    Real radius_y;
+    /// counterclockwise rotation of the x radius from the x axis
+    Real angle;
+
+    [[nodiscard]] Real half_width() const noexcept
+    {
+        using std::cos;
+        using std::sin;
+        using std::sqrt;
+        return sqrt(square(radius_x * cos(angle)) + square(radius_y * sin(angle)));
+    }
+
+    [[nodiscard]] Real half_height() const noexcept
+    {
+        using std::cos;
+        using std::sin;
+        using std::sqrt;
+        return sqrt(square(radius_x * sin(angle)) + square(radius_y * cos(angle)));
+    }
+
+    /// implicit form relative to the ellipse center
+    [[nodiscard]] Conic<Real> centered_conic() const noexcept
+    {
+        using std::cos;
+        using std::sin;
+        const auto cs = cos(angle);
+        const auto sn = sin(angle);
+        const auto inv_rx2 = 1 / square(radius_x);
+        const auto inv_ry2 = 1 / square(radius_y);
+        return {
+            square(cs) * inv_rx2 + square(sn) * inv_ry2,
+            2 * cs * sn * (inv_rx2 - inv_ry2),
+            square(sn) * inv_rx2 + square(cs) * inv_ry2,
+            0,
+            0,
+            -1,
+        };
+    }
+
+    [[nodiscard]] Conic<Real> conic() const noexcept
+    {
+        return centered_conic().translated(-center_x, -center_y);
+    }
+};
+
+template <typename RealT>
+struct ConicIntersection
+{
+    using Real = RealT;
+
+    std::array<Real, 4> x;
+    std::array<Real, 4> y;
+    std::size_t n_points;
+};
+
+namespace internal {
+
+/// resultant of the two conics with respect to y, a quartic in x whose real roots are the intersection abscissas
+template <typename Real>
+[[nodiscard]] std::array<Real, 5> intersection_quartic(const Conic<Real>& p, const Conic<Real>& q) noexcept
+{
+    // as quadratics in y: p.c*y^2 + (p.b*x + p.e)*y + (p.a*x^2 + p.d*x + p.f)
+    // u = p.c*q.gamma - q.c*p.gamma, v = p.c*q.beta - q.c*p.beta, w = p.beta*q.gamma - q.beta*p.gamma
+    const std::array<Real, 3> u{p.c * q.f - q.c * p.f, p.c * q.d - q.c * p.d, p.c * q.a - q.c * p.a};
+    const std::array<Real, 2> v{p.c * q.e - q.c * p.e, p.c * q.b - q.c * p.b};
+    const std::array<Real, 4> w{
+        p.e * q.f - q.e * p.f,
+        p.e * q.d + p.b * q.f - q.e * p.d - q.b * p.f,
+        p.e * q.a + p.b * q.d - q.e * p.a - q.b * p.d,
+        p.b * q.a - q.b * p.a,
+    };
+    // u^2 - v*w
+    return {
+        u[0] * u[0] - v[0] * w[0],
+        2 * u[0] * u[1] - v[0] * w[1] - v[1] * w[0],
+        u[1] * u[1] + 2 * u[0] * u[2] - v[0] * w[2] - v[1] * w[1],
+        2 * u[1] * u[2] - v[0] * w[3] - v[1] * w[2],
+        u[2] * u[2] - v[1] * w[3],
+    };
+}
+
+template <typename Real>
+void add_intersection_point(ConicIntersection<Real>& result, const Real x, const Real y, const Real tolerance) noexcept
+{
+    using std::abs;
+    for (std::size_t i = 0; i < result.n_points; ++i) {
+        if (abs(result.x[i] - x) <= tolerance * (1 + abs(x)) && abs(result.y[i] - y) <= tolerance * (1 + abs(y))) {
+            return;
+        }
+    }
+    if (result.n_points < 4) {
+        result.x[result.n_points] = x;
+        result.y[result.n_points] = y;
+        ++result.n_points;
+    }
+}
+
+template <typename Real>
+[[nodiscard]] bool on_conic(const Conic<Real>& conic, const Real x, const Real y, const Real tolerance) noexcept
+{
+    using std::abs;
+    return abs(conic(x, y)) <= tolerance * conic.magnitude(x, y);
+}
+
+/// Newton steps on both conics at once; roots of the quartic lose half their digits at double roots, which is the
+/// common case of intersections mirrored across a shared axis
+template <typename Real>
+void polish_intersection_point(const Conic<Real>& p, const Conic<Real>& q, Real& x, Real& y) noexcept
+{
+    using std::abs;
+    for (int iteration = 0; iteration < 2; ++iteration) {
+        const auto px = 2 * p.a * x + p.b * y + p.d;
+        const auto py = p.b * x + 2 * p.c * y + p.e;
+        const auto qx = 2 * q.a * x + q.b * y + q.d;
+        const auto qy = q.b * x + 2 * q.c * y + q.e;
+        const auto det = px * qy - py * qx;
+        if (abs(det) <= std::numeric_limits<Real>::epsilon() * (abs(px * qy) + abs(py * qx))) {
+            return;
+        }
+        const auto fp = p(x, y);
+        const auto fq = q(x, y);
+        x -= (fp * qy - fq * py) / det;
+        y -= (px * fq - qx * fp) / det;
+    }
+}
+
+template <typename Real>
+void add_candidate_point(
+    ConicIntersection<Real>& result, const Conic<Real>& p, const Conic<Real>& q, Real x, Real y, const Real tolerance
+) noexcept
+{
+    polish_intersection_point(p, q, x, y);
+    if (on_conic(p, x, y, tolerance) && on_conic(q, x, y, tolerance)) {
+        add_intersection_point(result, x, y, tolerance);
+    }
+}
+
+/// recovers the ordinates belonging to the abscissa `x` of a root of the intersection quartic
+template <typename Real>
+void back_substitute(
+    ConicIntersection<Real>& result, const Conic<Real>& p, const Conic<Real>& q, const Real x, const Real tolerance
+) noexcept
+{
+    using std::abs;
+    const auto u = (p.c * q.a - q.c * p.a) * x * x + (p.c * q.d - q.c * p.d) * x + (p.c * q.f - q.c * p.f);
+    const auto v = (p.c * q.b - q.c * p.b) * x + (p.c * q.e - q.c * p.e);
+    if (abs(v) > tolerance * (abs(p.c) + abs(q.c))) {
+        add_candidate_point(result, p, q, x, -u / v, tolerance);
+        return;
+    }
+    // both ordinates of the conic may be shared
+    const auto& r = (abs(p.c) >= abs(q.c)) ? p : q;
+    const auto [ys, n_ys] = quadratic_real_roots(std::array<Real, 3>{r.a * x * x + r.d * x + r.f, r.b * x + r.e, r.c});
+    for (std::size_t i = 0; i < n_ys; ++i) {
+        add_candidate_point(result, p, q, x, ys[i], tolerance);
+    }
+}
+
+/// Adds the points over the real roots of the intersection quartic `quartic`. Only the factor pairs with real roots are
+/// formed, as in `quartic_min_real_roots`, and a double root is back-substituted once.
+template <typename Real>
+void back_substitute_real_roots(
+    ConicIntersection<Real>& result,
+    const Conic<Real>& p,
+    const Conic<Real>& q,
+    const std::array<Real, 5>& quartic,
+    const Real tolerance
+) noexcept
+{
+    batch::internal::visit_real_root_pairs<Real>(
+        quartic,
+        std::numeric_limits<Real>::epsilon(),
+        [&](const Real center, const Real half_width) {
+            back_substitute(result, p, q, center - half_width, tolerance);
+            if (half_width != 0) {
+                back_substitute(result, p, q, center + half_width, tolerance);
+            }
+        }
+    );
+}
+
+template <typename Real>
+[[nodiscard]] bool vanishes(const std::array<Real, 5>& quartic) noexcept
+{
+    return std::all_of(quartic.begin(), quartic.end(), [](const Real c) { return c == 0; });
+}
+
+/// Adds the points found through the resultant with respect to y, returning false without adding any when the
+/// resultant is identically zero.
+template <typename Real>
+[[nodiscard]] bool intersect_by_resultant(
+    ConicIntersection<Real>& result, const Conic<Real>& p, const Conic<Real>& q, const Real tolerance
+) noexcept
+{
+    const auto quartic = intersection_quartic(p, q);
+    if (vanishes(quartic)) {
+        return false;
+    }
+    back_substitute_real_roots(result, p, q, quartic, tolerance);
+    return true;
+}
+
+/// the same curve with x and y exchanged
+template <typename Real>
+[[nodiscard]] Conic<Real> swapped_axes(const Conic<Real>& conic) noexcept
+{
+    return {conic.c, conic.b, conic.a, conic.e, conic.d, conic.f};
+}
+
+/// the same curve in coordinates (s, y) with x = s + y, which gives x*y terms a y^2 part
+template <typename Real>
+[[nodiscard]] Conic<Real> sheared(const Conic<Real>& conic) noexcept
+{
+    return {
+        conic.a,
+        2 * conic.a + conic.b,
+        conic.a + conic.b + conic.c,
+        conic.d,
+        conic.d + conic.e,
+        conic.f,
+    };
+}
+
+template <typename Real>
+[[nodiscard]] Real default_intersection_tolerance() noexcept
+{
+    using std::sqrt;
+    return sqrt(std::numeric_limits<Real>::epsilon());
+}
+
+} // namespace internal
+
+/// Real intersection points of two conics, at most four; coincident points are reported once. Conics that share a
+/// whole component, which meet in infinitely many points, are reported as not intersecting.
+template <typename Real>
+[[nodiscard]] ConicIntersection<Real> intersect(
+    const Conic<Real>& p, const Conic<Real>& q, const Real tolerance = internal::default_intersection_tolerance<Real>()
+) noexcept
+{
+    ConicIntersection<Real> result{};
+    if (internal::intersect_by_resultant(result, p, q, tolerance)) {
+        return result;
+    }
+    // Without a y^2 term in either conic, as for two parabolas y = a*x^2 + d*x + f, the resultant with respect to y
+    // vanishes; eliminate x instead, or, when there is no x^2 term either, y after shearing the x*y terms
+    if (p.a != 0 || q.a != 0) {
+        if (internal::intersect_by_resultant(result, internal::swapped_axes(p), internal::swapped_axes(q), tolerance)) {
+            std::swap(result.x, result.y);
+        }
+        return result;
+    }
+    if (p.b != 0 || q.b != 0) {
+        if (internal::intersect_by_resultant(result, internal::sheared(p), internal::sheared(q), tolerance)) {
+            for (std::size_t i = 0; i < result.n_points; ++i) {
+                result.x[i] += result.y[i];
+            }
+        }
+        return result;
+    }
+    // two lines
+    const auto det = p.d * q.e - p.e * q.d;
+    if (det != 0) {
+        result.x[0] = (p.e * q.f - q.e * p.f) / det;
+        result.y[0] = (q.d * p.f - p.d * q.f) / det;
+        result.n_points = 1;
+    }
+    return result;
+}
+
+/// true when the ellipses' bounding boxes or bounding circles are disjoint, so that they cannot intersect
+template <typename Real>
+[[nodiscard]] bool separated(const Ellipse<Real>& p, const Ellipse<Real>& q) noexcept
+{
+    using std::abs;
+    using std::max;
+    const auto dx = p.center_x - q.center_x;
+    const auto dy = p.center_y - q.center_y;
+    if (abs(dx) > p.half_width() + q.half_width() || abs(dy) > p.half_height() + q.half_height()) {
+        return true;
+    }
+    const auto reach = max(p.radius_x, p.radius_y) + max(q.radius_x, q.radius_y);
+    return square(dx) + square(dy) > square(reach);
+}
+
+namespace internal {
+
+template <typename Real>
+struct ConicBounds
+{
+    /// false for the conics with unbounded branches, which have no bounds
+    bool bounded;
+    Real center_x;
+    Real center_y;
+    Real half_width_squared;
+    Real half_height_squared;
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return bounded && (half_width_squared < 0 || half_height_squared < 0);
+    }
+};
+
+/// Bounds a conic whose quadratic part is definite: an ellipse, a single point, or a conic without real points, which
+/// gets negative extents.
+template <typename Real>
+[[nodiscard]] ConicBounds<Real> bounds(const Conic<Real>& conic) noexcept
+{
+    const auto det = 4 * conic.a * conic.c - square(conic.b);
+    if (!(det > 0)) {
+        return {false, 0, 0, 0, 0};
+    }
+    const auto center_x = (conic.b * conic.e - 2 * conic.c * conic.d) / det;
+    const auto center_y = (conic.b * conic.d - 2 * conic.a * conic.e) / det;
+    // about the center the conic is a*x^2 + b*x*y + c*y^2 = level
+    const auto level = -(conic.f + (conic.d * center_x + conic.e * center_y) / 2);
+    return {true, center_x, center_y, 4 * conic.c * level / det, 4 * conic.a * level / det};
+}
+
+} // namespace internal
+
+/// true when either conic has no real points, or both are ellipses with disjoint bounding boxes; conics with unbounded
+/// branches are never separated
+template <typename Real>
+[[nodiscard]] bool separated(const Conic<Real>& p, const Conic<Real>& q) noexcept
+{
+    using std::abs;
+    using std::sqrt;
+    const auto p_bounds = internal::bounds(p);
+    const auto q_bounds = internal::bounds(q);
+    if (p_bounds.empty() || q_bounds.empty()) {
+        return true;
+    }
+    if (!p_bounds.bounded || !q_bounds.bounded) {
+        return false;
+    }
+    return abs(p_bounds.center_x - q_bounds.center_x) >
+               sqrt(p_bounds.half_width_squared) + sqrt(q_bounds.half_width_squared) ||
+           abs(p_bounds.center_y - q_bounds.center_y) >
+               sqrt(p_bounds.half_height_squared) + sqrt(q_bounds.half_height_squared);
+}
+
+namespace internal {
+
+/// a pair of conics in coordinates whose origin is (x0, y0)
+template <typename Real>
+struct FramedConics
+{
+    Conic<Real> p;
+    Conic<Real> q;
+    Real x0;
+    Real y0;
+};
+
+/// the ellipses in coordinates centered between them, which keeps the coefficients of far-off ellipses well scaled
+template <typename Real>
+[[nodiscard]] FramedConics<Real> framed(const Ellipse<Real>& p, const Ellipse<Real>& q) noexcept
+{
+    const auto x0 = (p.center_x + q.center_x) / 2;
+    const auto y0 = (p.center_y + q.center_y) / 2;
+    return {
+        p.centered_conic().translated(x0 - p.center_x, y0 - p.center_y),
+        q.centered_conic().translated(x0 - q.center_x, y0 - q.center_y),
+        x0,
+        y0,
+    };
+}
+
+template <typename Real>
+[[nodiscard]] FramedConics<Real> framed(const Conic<Real>& p, const Conic<Real>& q) noexcept
+{
+    return {p, q, 0, 0};
+}
+
+} // namespace internal
+
+template <typename Real>
+[[nodiscard]] ConicIntersection<Real> intersect(
+    const Ellipse<Real>& p,
+    const Ellipse<Real>& q,
+    const Real tolerance = internal::default_intersection_tolerance<Real>()
+) noexcept
+{
+    if (separated(p, q)) {
+        return {};
+    }
+    const auto pair = internal::framed(p, q);
+    auto result = intersect(pair.p, pair.q, tolerance);
+    for (std::size_t i = 0; i < result.n_points; ++i) {
+        result.x[i] += pair.x0;
+        result.y[i] += pair.y0;
+    }
+    return result;
+}
+
+namespace batch {
+
+/// structure-of-arrays conic coefficients; `(*this)[i]` gathers conic i
+template <typename Real>
+struct ConicArrays
+{
+    const Real* a;
+    const Real* b;
+    const Real* c;
+    const Real* d;
+    const Real* e;
+    const Real* f;
+    std::size_t n;
+
+    [[nodiscard]] Conic<Real> operator[](const std::size_t i) const noexcept
+    {
+        return {a[i], b[i], c[i], d[i], e[i], f[i]};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return n;
+    }
+};
+
+/// structure-of-arrays ellipse parameters; `(*this)[i]` gathers ellipse i
+template <typename Real>
+struct EllipseArrays
+{
+    const Real* center_x;
+    const Real* center_y;
+    const Real* radius_x;
+    const Real* radius_y;
+    const Real* angle;
+    std::size_t n;
+
+    [[nodiscard]] Ellipse<Real> operator[](const std::size_t i) const noexcept
+    {
+        return {center_x[i], center_y[i], radius_x[i], radius_y[i], angle[i]};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return n;
+    }
+};
+
+/// Intersects `first[i]` with `second[i]` for every pair, writing point j of pair i to `x[j][i]`, `y[j][i]` and the
+/// number of points to `counts[i]`. Point slots at and beyond `counts[i]` are left untouched.
+///
+/// `first` and `second` are batches of `Conic` or `Ellipse`. Pairs go through in packets of `packet_size`, one pass per
+/// stage: pairs that are `separated` are rejected and the rest compacted, their conics are gathered into
+/// structure-of-arrays storage, the intersection quartics of all of them are formed in one loop, and only the real root
+/// pairs of each quartic are solved for and back-substituted.
+template <typename Real, typename Batch, typename Out, typename Count>
+void intersect(
+    const Batch& first,
+    const Batch& second,
+    const std::array<Out*, 4>& x,
+    const std::array<Out*, 4>& y,
+    Count* counts,
+    const Real tolerance = dm::math::internal::default_intersection_tolerance<Real>()
+) noexcept
+{
+    constexpr std::size_t packet_size = 64;
+
+    std::array<std::size_t, packet_size> active;
+    std::array<Real, packet_size> x0;
+    std::array<Real, packet_size> y0;
+    std::array<std::array<Real, packet_size>, 6> p;
+    std::array<std::array<Real, packet_size>, 6> q;
+    std::array<std::array<Real, packet_size>, 5> coefficients;
+
+    const auto n = std::size(first);
+    for (std::size_t begin = 0; begin < n; begin += packet_size) {
+        const auto n_pairs = (n - begin < packet_size) ? n - begin : packet_size;
+
+        std::size_t n_active = 0;
+        for (std::size_t i = begin; i < begin + n_pairs; ++i) {
+            counts[i] = 0;
+            active[n_active] = i;
+            n_active += !separated(first[i], second[i]);
+        }
+
+        for (std::size_t k = 0; k < n_active; ++k) {
+            const auto pair = dm::math::internal::framed(first[active[k]], second[active[k]]);
+            p[0][k] = pair.p.a;
+            p[1][k] = pair.p.b;
+            p[2][k] = pair.p.c;
+            p[3][k] = pair.p.d;
+            p[4][k] = pair.p.e;
+            p[5][k] = pair.p.f;
+            q[0][k] = pair.q.a;
+            q[1][k] = pair.q.b;
+            q[2][k] = pair.q.c;
+            q[3][k] = pair.q.d;
+            q[4][k] = pair.q.e;
+            q[5][k] = pair.q.f;
+            x0[k] = pair.x0;
+            y0[k] = pair.y0;
+        }
+
+        for (std::size_t k = 0; k < n_active; ++k) {
+            const auto c = dm::math::internal::intersection_quartic(
+                Conic<Real>{p[0][k], p[1][k], p[2][k], p[3][k], p[4][k], p[5][k]},
+                Conic<Real>{q[0][k], q[1][k], q[2][k], q[3][k], q[4][k], q[5][k]}
+            );
+            for (std::size_t j = 0; j < 5; ++j) {
+                coefficients[j][k] = c[j];
+            }
+        }
+
+        for (std::size_t k = 0; k < n_active; ++k) {
+            const Conic<Real> pc{p[0][k], p[1][k], p[2][k], p[3][k], p[4][k], p[5][k]};
+            const Conic<Real> qc{q[0][k], q[1][k], q[2][k], q[3][k], q[4][k], q[5][k]};
+            const std::array<Real, 5> c{
+                coefficients[0][k], coefficients[1][k], coefficients[2][k], coefficients[3][k], coefficients[4][k]
+            };
+            // conics without y^2 terms take the scalar path through another elimination
+            ConicIntersection<Real> result{};
+            if (dm::math::internal::vanishes(c)) {
+                result = dm::math::intersect(pc, qc, tolerance);
+            } else {
+                dm::math::internal::back_substitute_real_roots(result, pc, qc, c, tolerance);
+            }
+            const auto i = active[k];
+            for (std::size_t j = 0; j < result.n_points; ++j) {
+                x[j][i] = static_cast<Out>(result.x[j] + x0[k]);
+                y[j][i] = static_cast<Out>(result.y[j] + y0[k]);
+            }
+            counts[i] = static_cast<Count>(result.n_points);
+        }
+    }
+}
+
+} // namespace batch
+
+} // namespace dm::math
@@ -2,6 +2,7 @@
 
 #include "quadratic_roots.hpp"
 #include "small_integral_powers.hpp"
+#include "split_complex.hpp"
 
 #include <cassert>
 #include <cmath>
@@ -15,6 +16,23 @@ namespace dm::math {
 
 namespace internal {
 
+/// `T`, in a context that does not deduce it (std::type_identity_t in C++20)
+template <typename T>
+struct TypeIdentity
+{
+    using type = T;
+};
+
+template <typename T>
+using type_identity_t = typename TypeIdentity<T>::type;
+
+// unqualified calls find these for built-in types and the overloads of other `Real` types (e.g. Dual) by ADL
+using std::abs;
+using std::acos;
+using std::cbrt;
+using std::cos;
+using std::sqrt;
+
 #if 0
 template <typename RootPair>
 struct CubicRoots
@@ -58,6 +76,11 @@ struct CubicRoots
     {
         return {ComplexT{x1, y1}, ComplexT{x2, y2}, ComplexT{x3, y3}};
     }
+
+    SplitRoots<Real, 3> to_split()
+    {
+        return {{x1, x2, x3}, {y1, y2, y3}};
+    }
 };
 
 template <typename RealT>
@@ -80,7 +103,7 @@ struct CubicRealRoots
     }
 };
 
-template <typename RealT>
+template <typename RealT, template <typename> typename Complex = std::complex>
 struct MonicCubic
 {
     using Real = RealT;
@@ -93,7 +116,7 @@ struct MonicCubic
         return square(r()) <= -cube(q());
     }
 
-    [[nodiscard]] CubicRoots<Real> roots() const noexcept
+    [[nodiscard]] CubicRoots<Real, Complex> roots() const noexcept
     {
         if (pair_real()) {
             return {three_x1(), 0, three_x2(), 0, three_x3(), 0};
@@ -201,16 +224,39 @@ struct MonicCubic
 
 } // namespace internal
 
+template <typename Real, template <typename> typename Complex = std::complex, typename Coefficients>
+[[nodiscard]] auto monic_cubic_roots(const Coefficients& c) noexcept -> std::array<Complex<Real>, 3>
+{
+    return internal::MonicCubic<Real, Complex>{c[0], c[1], c[2]}.roots().to_array();
+}
+
+template <typename Real, template <typename> typename Complex = std::complex, typename Coefficients>
+[[nodiscard]] auto cubic_roots(const Coefficients& c) noexcept -> std::array<Complex<Real>, 3>
+{
+    return internal::MonicCubic<Real, Complex>{c[0] / c[3], c[1] / c[3], c[2] / c[3]}.roots().to_array();
+}
+
+// `<Real, Coefficients>` spellings from before the `Complex` parameter. Coefficients is not deduced here, so calls that
+// leave it to deduction pick the overloads above.
+
 template <typename Real, typename Coefficients>
-[[nodiscard]] auto monic_cubic_roots(const Coefficients& c) noexcept -> std::array<std::complex<Real>, 3>
+[[nodiscard]] auto monic_cubic_roots(const internal::type_identity_t<Coefficients>& c) noexcept
+    -> std::array<std::complex<Real>, 3>
 {
-    return internal::MonicCubic<Real>{c[0], c[1], c[2]}.roots().to_array();
+    return monic_cubic_roots<Real, std::complex, Coefficients>(c);
 }
 
 template <typename Real, typename Coefficients>
-[[nodiscard]] auto cubic_roots(const Coefficients& c) noexcept -> std::array<std::complex<Real>, 3>
+[[nodiscard]] auto cubic_roots(const internal::type_identity_t<Coefficients>& c) noexcept
+    -> std::array<std::complex<Real>, 3>
 {
-    return internal::MonicCubic<Real>{c[0] / c[3], c[1] / c[3], c[2] / c[3]}.roots().to_array();
+    return cubic_roots<Real, std::complex, Coefficients>(c);
+}
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] auto cubic_roots_split(const Coefficients& c) noexcept -> SplitRoots<Real, 3>
+{
+    return internal::MonicCubic<Real>{c[0] / c[3], c[1] / c[3], c[2] / c[3]}.roots().to_split();
 }
 
 template <typename Real, typename Coefficients>
@@ -231,4 +277,30 @@ template <typename Real, typename Coefficients>
     return internal::MonicCubic<Real>{c[0] / c[3], c[1] / c[3], c[2] / c[3]}.real_roots().to_array();
 }
 
+#define POLYNOMIAL_ROOTS_CUBIC_TEMPLATES(prefix, Real)                                                                 \
+    prefix template struct internal::CubicRoots<Real>;                                                                 \
+    prefix template struct internal::CubicRealRoots<Real>;                                                             \
+    prefix template struct internal::MonicCubic<Real>;                                                                 \
+    prefix template std::array<std::complex<Real>, 3> monic_cubic_roots<Real, std::complex, std::array<Real, 3>>(      \
+        const std::array<Real, 3>&                                                                                     \
+    ) noexcept;                                                                                                        \
+    prefix template std::array<std::complex<Real>, 3> cubic_roots<Real, std::complex, std::array<Real, 4>>(            \
+        const std::array<Real, 4>&                                                                                     \
+    ) noexcept;                                                                                                        \
+    prefix template SplitRoots<Real, 3> cubic_roots_split<Real, std::array<Real, 4>>(                                  \
+        const std::array<Real, 4>&                                                                                     \
+    ) noexcept;                                                                                                        \
+    prefix template std::pair<std::array<Real, 3>, std::size_t> monic_cubic_real_roots<Real, std::array<Real, 3>>(     \
+        const std::array<Real, 3>&                                                                                     \
+    ) noexcept;                                                                                                        \
+    prefix template std::pair<std::array<Real, 3>, std::size_t> cubic_real_roots<Real, std::array<Real, 4>>(           \
+        const std::array<Real, 4>&                                                                                     \
+    ) noexcept;
+
+#ifdef POLYNOMIAL_ROOTS_EXTERN_TEMPLATES
+POLYNOMIAL_ROOTS_CUBIC_TEMPLATES(extern, float)
+POLYNOMIAL_ROOTS_CUBIC_TEMPLATES(extern, double)
+POLYNOMIAL_ROOTS_CUBIC_TEMPLATES(extern, long double)
+#endif
+
 } // namespace dm::math
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+namespace dm::math {
+
+/// forward-mode dual number `value + derivative * e` with e^2 = 0, usable as the `Real` type of the solvers
+template <typename RealT>
+class Dual
+{
+  public:
+    using Real = RealT;
+
+    constexpr Dual() noexcept : value_(0), derivative_(0) {}
+    constexpr Dual(const Real value) noexcept : value_(value), derivative_(0) {}
+    constexpr Dual(const Real value, const Real derivative) noexcept : value_(value), derivative_(derivative) {}
+
+    [[nodiscard]] constexpr Real value() const noexcept
+    {
+        return value_;
+    }
+
+    [[nodiscard]] constexpr Real derivative() const noexcept
+    {
+        return derivative_;
+    }
+
+    constexpr Dual& operator+=(const Dual& other) noexcept
+    {
+        return *this = *this + other;
+    }
+
+    constexpr Dual& operator-=(const Dual& other) noexcept
+    {
+        return *this = *this - other;
+    }
+
+    constexpr Dual& operator*=(const Dual& other) noexcept
+    {
+        return *this = *this * other;
+    }
+
+    constexpr Dual& operator/=(const Dual& other) noexcept
+    {
+        return *this = *this / other;
+    }
+
+    [[nodiscard]] friend constexpr Dual operator+(const Dual& x) noexcept
+    {
+        return x;
+    }
+
+    [[nodiscard]] friend constexpr Dual operator-(const Dual& x) noexcept
+    {
+        return {-x.value_, -x.derivative_};
+    }
+
+    [[nodiscard]] friend constexpr Dual operator+(const Dual& x, const Dual& y) noexcept
+    {
+        return {x.value_ + y.value_, x.derivative_ + y.derivative_};
+    }
+
+    [[nodiscard]] friend constexpr Dual operator-(const Dual& x, const Dual& y) noexcept
+    {
+        return {x.value_ - y.value_, x.derivative_ - y.derivative_};
+    }
+
+    [[nodiscard]] friend constexpr Dual operator*(const Dual& x, const Dual& y) noexcept
+    {
+        return {x.value_ * y.value_, x.derivative_ * y.value_ + x.value_ * y.derivative_};
+    }
+
+    [[nodiscard]] friend constexpr Dual operator/(const Dual& x, const Dual& y) noexcept
+    {
+        return {x.value_ / y.value_, (x.derivative_ * y.value_ - x.value_ * y.derivative_) / (y.value_ * y.value_)};
+    }
+
+    // comparisons look at the value only, so branches in the solvers follow the primal computation
+
+    [[nodiscard]] friend constexpr bool operator==(const Dual& x, const Dual& y) noexcept
+    {
+        return x.value_ == y.value_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const Dual& x, const Dual& y) noexcept
+    {
+        return x.value_ != y.value_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<(const Dual& x, const Dual& y) noexcept
+    {
+        return x.value_ < y.value_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<=(const Dual& x, const Dual& y) noexcept
+    {
+        return x.value_ <= y.value_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>(const Dual& x, const Dual& y) noexcept
+    {
+        return x.value_ > y.value_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>=(const Dual& x, const Dual& y) noexcept
+    {
+        return x.value_ >= y.value_;
+    }
+
+    [[nodiscard]] friend Dual abs(const Dual& x) noexcept
+    {
+        return (x.value_ < 0) ? -x : x;
+    }
+
+    /// At 0 the derivative d / 0 is infinite with the sign of d. If d is 0 as well, the argument stays at 0 to first
+    /// order and so does its square root: the derivative is 0 rather than the NaN of 0 / 0.
+    [[nodiscard]] friend Dual sqrt(const Dual& x) noexcept
+    {
+        using std::sqrt;
+        const auto root = sqrt(x.value_);
+        if (root == 0 && x.derivative_ == 0) {
+            return {root, 0};
+        }
+        return {root, x.derivative_ / (2 * root)};
+    }
+
+    [[nodiscard]] friend Dual cbrt(const Dual& x) noexcept
+    {
+        using std::cbrt;
+        const auto root = cbrt(x.value_);
+        return {root, x.derivative_ / (3 * root * root)};
+    }
+
+    [[nodiscard]] friend Dual cos(const Dual& x) noexcept
+    {
+        using std::cos;
+        using std::sin;
+        return {cos(x.value_), -sin(x.value_) * x.derivative_};
+    }
+
+    [[nodiscard]] friend Dual sin(const Dual& x) noexcept
+    {
+        using std::cos;
+        using std::sin;
+        return {sin(x.value_), cos(x.value_) * x.derivative_};
+    }
+
+    [[nodiscard]] friend Dual acos(const Dual& x) noexcept
+    {
+        using std::acos;
+        using std::sqrt;
+        return {acos(x.value_), -x.derivative_ / sqrt(1 - x.value_ * x.value_)};
+    }
+
+  private:
+    Real value_;
+    Real derivative_;
+};
+
+} // namespace dm::math
+
+namespace std {
+
+template <typename Real>
+class numeric_limits<dm::math::Dual<Real>>
+{
+  public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool has_infinity = std::numeric_limits<Real>::has_infinity;
+    static constexpr bool has_quiet_NaN = std::numeric_limits<Real>::has_quiet_NaN;
+
+    static constexpr dm::math::Dual<Real> epsilon() noexcept
+    {
+        return std::numeric_limits<Real>::epsilon();
+    }
+
+    static constexpr dm::math::Dual<Real> min() noexcept
+    {
+        return std::numeric_limits<Real>::min();
+    }
+
+    static constexpr dm::math::Dual<Real> max() noexcept
+    {
+        return std::numeric_limits<Real>::max();
+    }
+
+    static constexpr dm::math::Dual<Real> lowest() noexcept
+    {
+        return std::numeric_limits<Real>::lowest();
+    }
+
+    static constexpr dm::math::Dual<Real> infinity() noexcept
+    {
+        return std::numeric_limits<Real>::infinity();
+    }
+
+    static constexpr dm::math::Dual<Real> quiet_NaN() noexcept
+    {
+        return std::numeric_limits<Real>::quiet_NaN();
+    }
+};
+
+} // namespace std
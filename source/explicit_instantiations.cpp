@@ -0,0 +1,19 @@
+#include "quadratic_roots.hpp"
+#include "cubic_roots.hpp"
+#include "quartic_roots.hpp"
+
+namespace dm::math {
+
+POLYNOMIAL_ROOTS_QUADRATIC_TEMPLATES(, float)
+POLYNOMIAL_ROOTS_QUADRATIC_TEMPLATES(, double)
+POLYNOMIAL_ROOTS_QUADRATIC_TEMPLATES(, long double)
+
+POLYNOMIAL_ROOTS_CUBIC_TEMPLATES(, float)
+POLYNOMIAL_ROOTS_CUBIC_TEMPLATES(, double)
+POLYNOMIAL_ROOTS_CUBIC_TEMPLATES(, long double)
+
+POLYNOMIAL_ROOTS_QUARTIC_TEMPLATES(, float)
+POLYNOMIAL_ROOTS_QUARTIC_TEMPLATES(, double)
+POLYNOMIAL_ROOTS_QUARTIC_TEMPLATES(, long double)
+
+} // namespace dm::math
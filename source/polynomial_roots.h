@@ -0,0 +1,115 @@
+#ifndef DM_POLYNOMIAL_ROOTS_H
+#define DM_POLYNOMIAL_ROOTS_H
+
+/* C interface to the polynomial root solvers, for FFI callers.
+ *
+ * Every function solves a batch of `n` polynomials in one call over caller-owned buffers and never allocates, throws
+ * or retains a pointer. Strides are in elements, not bytes, and may be negative:
+ *
+ *   coefficient k of polynomial i   coefficients[i * polynomial_stride + k * coefficient_stride]
+ *   root j of polynomial i          roots_*[i * root_polynomial_stride + j * root_stride]
+ *
+ * so the same entry points read arrays of structs (polynomial_stride = degree + 1, coefficient_stride = 1),
+ * structure-of-arrays columns (polynomial_stride = 1, coefficient_stride = n) and anything in between. Coefficients
+ * are ordered lowest degree first. Real-root functions write the number of real roots of polynomial i to `counts[i]`
+ * and leave the root slots beyond it untouched.
+ *
+ * On x86-64 the batch loops are compiled for several instruction sets and the first call picks the best one the host
+ * supports. Floating-point contraction is disabled in every variant and NaN roots are written as the default quiet NaN,
+ * so all of them return bit-identical roots.
+ * dm_polyroots_force_isa pins the choice, e.g. to compare kernels in a benchmark.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(DM_POLYROOTS_BUILDING)
+#define DM_POLYROOTS_API __declspec(dllexport)
+#else
+#define DM_POLYROOTS_API __declspec(dllimport)
+#endif
+#else
+#define DM_POLYROOTS_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum dm_polyroots_status
+{
+    DM_POLYROOTS_OK = 0,
+    DM_POLYROOTS_NULL_POINTER = 1,
+    DM_POLYROOTS_UNSUPPORTED_ISA = 2,
+} dm_polyroots_status;
+
+typedef enum dm_polyroots_isa
+{
+    DM_POLYROOTS_ISA_BASELINE = 0,
+    DM_POLYROOTS_ISA_SSE4_2 = 1,
+    DM_POLYROOTS_ISA_AVX2 = 2,   /* AVX2 and FMA */
+    DM_POLYROOTS_ISA_AVX512 = 3, /* AVX-512 F, DQ, VL and BW */
+} dm_polyroots_isa;
+
+typedef struct dm_polyroots_layout
+{
+    ptrdiff_t polynomial_stride;
+    ptrdiff_t coefficient_stride;
+    ptrdiff_t root_polynomial_stride;
+    ptrdiff_t root_stride;
+} dm_polyroots_layout;
+
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_quartic_roots_f64(
+    size_t n, const double* coefficients, double* roots_real, double* roots_imag, dm_polyroots_layout layout
+);
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_quartic_roots_f32(
+    size_t n, const float* coefficients, float* roots_real, float* roots_imag, dm_polyroots_layout layout
+);
+
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_quartic_real_roots_f64(
+    size_t n, const double* coefficients, double* roots, uint8_t* counts, dm_polyroots_layout layout
+);
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_quartic_real_roots_f32(
+    size_t n, const float* coefficients, float* roots, uint8_t* counts, dm_polyroots_layout layout
+);
+
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_cubic_roots_f64(
+    size_t n, const double* coefficients, double* roots_real, double* roots_imag, dm_polyroots_layout layout
+);
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_cubic_roots_f32(
+    size_t n, const float* coefficients, float* roots_real, float* roots_imag, dm_polyroots_layout layout
+);
+
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_cubic_real_roots_f64(
+    size_t n, const double* coefficients, double* roots, uint8_t* counts, dm_polyroots_layout layout
+);
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_cubic_real_roots_f32(
+    size_t n, const float* coefficients, float* roots, uint8_t* counts, dm_polyroots_layout layout
+);
+
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_quadratic_real_roots_f64(
+    size_t n, const double* coefficients, double* roots, uint8_t* counts, dm_polyroots_layout layout
+);
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_quadratic_real_roots_f32(
+    size_t n, const float* coefficients, float* roots, uint8_t* counts, dm_polyroots_layout layout
+);
+
+/* Best instruction set the host supports that this build has kernels for. */
+DM_POLYROOTS_API dm_polyroots_isa dm_polyroots_detected_isa(void);
+
+/* Instruction set of the kernels currently used by the entry points above. */
+DM_POLYROOTS_API dm_polyroots_isa dm_polyroots_selected_isa(void);
+
+/* Use the kernels for `isa` from now on; DM_POLYROOTS_UNSUPPORTED_ISA leaves the selection unchanged if the host or
+ * this build cannot run them. Calls already running on other threads finish with the kernels they started with. */
+DM_POLYROOTS_API dm_polyroots_status dm_polyroots_force_isa(dm_polyroots_isa isa);
+
+/* Name of `isa` as a static string, e.g. "avx2", or NULL for values outside the enum. */
+DM_POLYROOTS_API const char* dm_polyroots_isa_name(dm_polyroots_isa isa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+#include "polynomial_roots.h"
+
+#include "batch_kernels.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using dm::math::kernels::ComplexKernel;
+using dm::math::kernels::RealKernel;
+
+template <typename Real>
+dm_polyroots_status solve_complex(
+    const ComplexKernel<Real> kernel,
+    const std::size_t n,
+    const Real* coefficients,
+    Real* roots_real,
+    Real* roots_imag,
+    const dm_polyroots_layout& layout
+) noexcept
+{
+    if (n == 0) {
+        return DM_POLYROOTS_OK;
+    }
+    if (coefficients == nullptr || roots_real == nullptr || roots_imag == nullptr) {
+        return DM_POLYROOTS_NULL_POINTER;
+    }
+    kernel(n, coefficients, roots_real, roots_imag, layout);
+    return DM_POLYROOTS_OK;
+}
+
+template <typename Real>
+dm_polyroots_status solve_real(
+    const RealKernel<Real> kernel,
+    const std::size_t n,
+    const Real* coefficients,
+    Real* roots,
+    std::uint8_t* counts,
+    const dm_polyroots_layout& layout
+) noexcept
+{
+    if (n == 0) {
+        return DM_POLYROOTS_OK;
+    }
+    if (coefficients == nullptr || roots == nullptr || counts == nullptr) {
+        return DM_POLYROOTS_NULL_POINTER;
+    }
+    kernel(n, coefficients, roots, counts, layout);
+    return DM_POLYROOTS_OK;
+}
+
+} // namespace
+
+#define DM_POLYROOTS_DEFINE_ENTRY_POINTS(Real, suffix)                                                                 \
+    dm_polyroots_status dm_polyroots_quartic_roots_##suffix(                                                           \
+        size_t n, const Real* coefficients, Real* roots_real, Real* roots_imag, dm_polyroots_layout layout             \
+    )                                                                                                                  \
+    {                                                                                                                  \
+        return solve_complex(                                                                                          \
+            dm::math::kernels::selected().quartic_roots_##suffix, n, coefficients, roots_real, roots_imag, layout      \
+        );                                                                                                             \
+    }                                                                                                                  \
+    dm_polyroots_status dm_polyroots_quartic_real_roots_##suffix(                                                      \
+        size_t n, const Real* coefficients, Real* roots, uint8_t* counts, dm_polyroots_layout layout                   \
+    )                                                                                                                  \
+    {                                                                                                                  \
+        return solve_real(                                                                                             \
+            dm::math::kernels::selected().quartic_real_roots_##suffix, n, coefficients, roots, counts, layout          \
+        );                                                                                                             \
+    }                                                                                                                  \
+    dm_polyroots_status dm_polyroots_cubic_roots_##suffix(                                                             \
+        size_t n, const Real* coefficients, Real* roots_real, Real* roots_imag, dm_polyroots_layout layout             \
+    )                                                                                                                  \
+    {                                                                                                                  \
+        return solve_complex(                                                                                          \
+            dm::math::kernels::selected().cubic_roots_##suffix, n, coefficients, roots_real, roots_imag, layout        \
+        );                                                                                                             \
+    }                                                                                                                  \
+    dm_polyroots_status dm_polyroots_cubic_real_roots_##suffix(                                                        \
+        size_t n, const Real* coefficients, Real* roots, uint8_t* counts, dm_polyroots_layout layout                   \
+    )                                                                                                                  \
+    {                                                                                                                  \
+        return solve_real(                                                                                             \
+            dm::math::kernels::selected().cubic_real_roots_##suffix, n, coefficients, roots, counts, layout            \
+        );                                                                                                             \
+    }                                                                                                                  \
+    dm_polyroots_status dm_polyroots_quadratic_real_roots_##suffix(                                                    \
+        size_t n, const Real* coefficients, Real* roots, uint8_t* counts, dm_polyroots_layout layout                   \
+    )                                                                                                                  \
+    {                                                                                                                  \
+        return solve_real(                                                                                             \
+            dm::math::kernels::selected().quadratic_real_roots_##suffix, n, coefficients, roots, counts, layout        \
+        );                                                                                                             \
+    }
+
+extern "C" {
+
+DM_POLYROOTS_DEFINE_ENTRY_POINTS(double, f64)
+DM_POLYROOTS_DEFINE_ENTRY_POINTS(float, f32)
+
+dm_polyroots_isa dm_polyroots_detected_isa(void)
+{
+    return dm::math::kernels::detected_isa();
+}
+
+dm_polyroots_isa dm_polyroots_selected_isa(void)
+{
+    return dm::math::kernels::selected().isa;
+}
+
+dm_polyroots_status dm_polyroots_force_isa(const dm_polyroots_isa isa)
+{
+    return dm::math::kernels::select(isa) ? DM_POLYROOTS_OK : DM_POLYROOTS_UNSUPPORTED_ISA;
+}
+
+const char* dm_polyroots_isa_name(const dm_polyroots_isa isa)
+{
+    switch (isa) {
+    case DM_POLYROOTS_ISA_BASELINE:
+        return "baseline";
+    case DM_POLYROOTS_ISA_SSE4_2:
+        return "sse4.2";
+    case DM_POLYROOTS_ISA_AVX2:
+        return "avx2";
+    case DM_POLYROOTS_ISA_AVX512:
+        return "avx512";
+    }
+    return nullptr;
+}
+
+} // extern "C"
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "split_complex.hpp"
+
 #include <array>
 #include <cmath>
 #include <complex>
@@ -9,6 +11,9 @@ namespace dm::math {
 
 namespace internal {
 
+// unqualified calls find these for built-in types and the overloads of other `Real` types (e.g. Dual) by ADL
+using std::sqrt;
+
 template <typename Real, template <typename> typename Complex = std::complex>
 struct QuadraticRoots
 {
@@ -23,6 +28,11 @@ struct QuadraticRoots
     {
         return {ComplexT{x1, y1}, ComplexT{x2, -y1}};
     }
+
+    SplitRoots<Real, 2> to_split()
+    {
+        return {{x1, x2}, {y1, -y1}};
+    }
 };
 
 template <typename Real>
@@ -44,19 +54,19 @@ struct QuadraticRealRoots
     }
 };
 
-template <typename Real>
+template <typename Real, template <typename> typename Complex = std::complex>
 struct MonicQuadratic
 {
     using RealT = Real;
 
     std::array<RealT, 2> c;
 
-    [[nodiscard]] QuadraticRoots<RealT> roots() const noexcept
+    [[nodiscard]] QuadraticRoots<RealT, Complex> roots() const noexcept
     {
         if (pair_real()) {
-            return {two_x1(), 0, two_x2(), 0};
+            return {two_x1(), two_x2(), 0};
         } else {
-            return {one_x1(), one_y1(), one_x1(), -one_y1()};
+            return {one_x1(), one_x1(), one_y1()};
         }
     }
 
@@ -106,7 +116,13 @@ struct MonicQuadratic
 template <typename Real, template <typename> typename Complex = std::complex>
 std::array<Complex<Real>, 2> quadratic_roots(const std::array<Real, 3>& c)
 {
-    return internal::MonicQuadratic{c[0] / c[2], c[1] / c[2]}.roots().to_array();
+    return internal::MonicQuadratic<Real, Complex>{c[0] / c[2], c[1] / c[2]}.roots().to_array();
+}
+
+template <typename Real>
+SplitRoots<Real, 2> quadratic_roots_split(const std::array<Real, 3>& c)
+{
+    return internal::MonicQuadratic<Real>{c[0] / c[2], c[1] / c[2]}.roots().to_split();
 }
 
 template <typename Real>
@@ -116,9 +132,23 @@ std::pair<std::array<Real, 2>, size_t> quadratic_real_roots(const std::array<Rea
         if (c[1] == 0) {
             return {{}, 0};
         }
-        return {{0, -c[0] / c[1]}, 2};
+        return {{-c[0] / c[1], 0}, 1};
     }
     return internal::MonicQuadratic<Real>{c[0] / c[2], c[1] / c[2]}.real_roots().to_array();
 }
 
+#define POLYNOMIAL_ROOTS_QUADRATIC_TEMPLATES(prefix, Real)                                                             \
+    prefix template struct internal::QuadraticRoots<Real>;                                                             \
+    prefix template struct internal::QuadraticRealRoots<Real>;                                                         \
+    prefix template struct internal::MonicQuadratic<Real>;                                                             \
+    prefix template std::array<std::complex<Real>, 2> quadratic_roots<Real, std::complex>(const std::array<Real, 3>&); \
+    prefix template SplitRoots<Real, 2> quadratic_roots_split<Real>(const std::array<Real, 3>&);                       \
+    prefix template std::pair<std::array<Real, 2>, size_t> quadratic_real_roots<Real>(const std::array<Real, 3>&);
+
+#ifdef POLYNOMIAL_ROOTS_EXTERN_TEMPLATES
+POLYNOMIAL_ROOTS_QUADRATIC_TEMPLATES(extern, float)
+POLYNOMIAL_ROOTS_QUADRATIC_TEMPLATES(extern, double)
+POLYNOMIAL_ROOTS_QUADRATIC_TEMPLATES(extern, long double)
+#endif
+
 } // namespace dm::math
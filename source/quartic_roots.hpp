@@ -13,6 +13,9 @@ namespace dm::math {
 
 namespace internal {
 
+// unqualified calls find these for built-in types and the overloads of other `Real` types (e.g. Dual) by ADL
+using std::sqrt;
+
 template <typename Real, template <typename> typename Complex = std::complex>
 struct QuarticRoots
 {
@@ -32,6 +35,11 @@ struct QuarticRoots
     {
         return {ComplexT{x1, y1}, ComplexT{x2, y2}, ComplexT{x3, y3}, ComplexT{x4, y4}};
     }
+
+    SplitRoots<Real, 4> to_split()
+    {
+        return {{x1, x2, x3, x4}, {y1, y2, y3, y4}};
+    }
 };
 
 template <typename Real>
@@ -80,29 +88,30 @@ class MonicQuartic
         return radicand2(r) >= 0;
     }
 
-    [[nodiscard]] QuarticRoots<RealT> roots(const Real epsilon = std::numeric_limits<Real>::epsilon()) const noexcept
+    [[nodiscard]] QuarticRoots<RealT, Complex>
+    roots(const Real epsilon = std::numeric_limits<Real>::epsilon()) const noexcept
     {
-        QuarticRoots<RealT> roots;
+        QuarticRoots<RealT, Complex> roots;
         const auto r = resolvent_cubic_roots();
         if (pair_one_real(r)) {
-            roots.x1 = sqrt(r.x1) - C() + sqrt(radicand1(r));
+            roots.x1 = sqrt_x1(r) - C() + sqrt(radicand1(r));
             roots.y1 = 0;
-            roots.x2 = sqrt(r.x1) - C() - sqrt(radicand1(r));
+            roots.x2 = sqrt_x1(r) - C() - sqrt(radicand1(r));
             roots.y2 = 0;
         } else {
-            roots.x1 = sqrt(r.x1) - C();
+            roots.x1 = sqrt_x1(r) - C();
             roots.y1 = sqrt(-radicand1(r));
             threshold_imaginary_root(roots.x1, roots.y1, epsilon);
             roots.x2 = roots.x1;
             roots.y2 = -roots.y1;
         }
         if (pair_two_real(r)) {
-            roots.x3 = -sqrt(r.x1) - C() + sqrt(radicand2(r));
+            roots.x3 = -sqrt_x1(r) - C() + sqrt(radicand2(r));
             roots.y3 = 0;
-            roots.x4 = -sqrt(r.x1) - C() - sqrt(radicand2(r));
+            roots.x4 = -sqrt_x1(r) - C() - sqrt(radicand2(r));
             roots.y4 = 0;
         } else {
-            roots.x3 = -sqrt(r.x1) - C();
+            roots.x3 = -sqrt_x1(r) - C();
             roots.y3 = sqrt(-radicand2(r));
             threshold_imaginary_root(roots.x3, roots.y3, epsilon);
             roots.x4 = roots.x3;
@@ -114,7 +123,7 @@ class MonicQuartic
     [[nodiscard]] QuarticRealRoots<RealT>
     real_roots(const Real epsilon = std::numeric_limits<Real>::epsilon()) const noexcept
     {
-        QuarticRoots<RealT> all_roots{roots(epsilon)};
+        const auto all_roots = roots(epsilon);
         QuarticRealRoots<RealT> real_roots;
         real_roots.pair_one_real = all_roots.y1 == 0;
         if (real_roots.pair_one_real) {
@@ -129,6 +138,40 @@ class MonicQuartic
         return real_roots;
     }
 
+    [[nodiscard]] std::size_t real_root_count(const Real epsilon = std::numeric_limits<Real>::epsilon()) const noexcept
+    {
+        const auto r = resolvent_cubic_roots();
+        std::size_t count = 0;
+        if (pair_one_real(r) || pair_thresholded_real(sqrt_x1(r) - C(), radicand1(r), epsilon)) {
+            count += 2;
+        }
+        if (pair_two_real(r) || pair_thresholded_real(-sqrt_x1(r) - C(), radicand2(r), epsilon)) {
+            count += 2;
+        }
+        return count;
+    }
+
+    /// Calls `visit(center, half_width)` for each factor quadratic with real roots `center - half_width` and
+    /// `center + half_width`, classified like `real_roots`. Callers reducing the roots to one value evaluate only the
+    /// roots they need, and pairs without real roots cost no square root.
+    template <typename Visit>
+    void visit_real_root_pairs(const Real epsilon, Visit&& visit) const noexcept
+    {
+        const auto r = resolvent_cubic_roots();
+        const auto s = sqrt_x1(r);
+        const auto spread = r.x2 + r.x3;
+        const auto k_r = k(r);
+        const auto visit_pair = [&](const RealT center, const RealT radicand) {
+            if (radicand >= 0) {
+                visit(center, sqrt(radicand));
+            } else if (pair_thresholded_real(center, radicand, epsilon)) {
+                visit(center, RealT{0});
+            }
+        };
+        visit_pair(s - C(), spread - k_r);
+        visit_pair(-s - C(), spread + k_r);
+    }
+
   private:
     [[nodiscard]] RealT C() const noexcept
     {
@@ -150,6 +193,13 @@ class MonicQuartic
         return A[2] - 6 * square(C());
     }
 
+    [[nodiscard]] static bool pair_thresholded_real(RealT x, const RealT radicand, const Real epsilon) noexcept
+    {
+        RealT y = sqrt(-radicand);
+        threshold_imaginary_root(x, y, epsilon);
+        return y == 0;
+    }
+
     [[nodiscard]] RealT sigma() const noexcept
     {
         return (b1() > 0) ? 1 : -1;
@@ -171,9 +221,27 @@ class MonicQuartic
         return roots;
     }
 
+    /// sqrt(r.x1). The resolvent roots multiply to b1^2 / 64, so sqrt_x1(r) * k(r) == b1 / 4. For a biquadratic
+    /// (b1 == 0) whichever of the two is 0 is taken from that product rather than from the square root of a rounded
+    /// resolvent root: it is then exactly 0, and for number types such as Dual it keeps the derivative of b1, which the
+    /// square root of a root quadratic in b1 would lose.
+    [[nodiscard]] RealT sqrt_x1(const CubicRoots<RealT>& r) const noexcept
+    {
+        const auto product = r.x2 * r.x3 + square(r.y2);
+        if (b1() == 0 && product > r.x1) {
+            return b1() / (8 * sigma() * sqrt(product));
+        }
+        return sqrt(r.x1);
+    }
+
+    /// 2 sigma sqrt(r.x2 r.x3 + r.y2^2), or b1 / (4 sqrt_x1(r)) for a biquadratic; see `sqrt_x1`
     [[nodiscard]] RealT k(const CubicRoots<RealT>& r) const noexcept
     {
-        return 2 * sigma() * sqrt(r.x2 * r.x3 + square(r.y2));
+        const auto product = r.x2 * r.x3 + square(r.y2);
+        if (b1() == 0 && product <= r.x1 && r.x1 > 0) {
+            return b1() / (4 * sqrt(r.x1));
+        }
+        return 2 * sigma() * sqrt(product);
     }
 
     [[nodiscard]] RealT radicand1(const CubicRoots<RealT>& r) const noexcept
@@ -187,20 +255,61 @@ class MonicQuartic
     }
 };
 
+/// insertion sort of the first `n` roots; cheaper than std::sort for at most four elements
+template <typename Real, std::size_t N>
+void sort_roots(std::array<Real, N>& roots, const std::size_t n) noexcept
+{
+    for (std::size_t i = 1; i < n; ++i) {
+        const auto root = roots[i];
+        auto j = i;
+        for (; j > 0 && root < roots[j - 1]; --j) {
+            roots[j] = roots[j - 1];
+        }
+        roots[j] = root;
+    }
+}
+
 } // namespace internal
 
-template <typename Real, typename Coefficients>
+template <typename Real, template <typename> typename Complex = std::complex, typename Coefficients>
 [[nodiscard]] auto monic_quartic_roots(const Coefficients& c, const Real epsilon = std::numeric_limits<Real>::epsilon())
-    -> std::array<std::complex<Real>, 4>
+    -> std::array<Complex<Real>, 4>
 {
-    return internal::MonicQuartic<Real>{c[0], c[1], c[2], c[3]}.roots(epsilon).to_array();
+    return internal::MonicQuartic<Real, Complex>{c[0], c[1], c[2], c[3]}.roots(epsilon).to_array();
 }
 
-template <typename Real, typename Coefficients>
+template <typename Real, template <typename> typename Complex = std::complex, typename Coefficients>
 [[nodiscard]] auto quartic_roots(const Coefficients& c, const Real epsilon = std::numeric_limits<Real>::epsilon())
-    -> std::array<std::complex<Real>, 4>
+    -> std::array<Complex<Real>, 4>
+{
+    return internal::MonicQuartic<Real, Complex>{c[0] / c[4], c[1] / c[4], c[2] / c[4], c[3] / c[4]}
+        .roots(epsilon)
+        .to_array();
+}
+
+// `<Real, Coefficients>` spellings from before the `Complex` parameter; see cubic_roots.hpp
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] auto monic_quartic_roots(
+    const internal::type_identity_t<Coefficients>& c, const Real epsilon = std::numeric_limits<Real>::epsilon()
+) -> std::array<std::complex<Real>, 4>
+{
+    return monic_quartic_roots<Real, std::complex, Coefficients>(c, epsilon);
+}
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] auto quartic_roots(
+    const internal::type_identity_t<Coefficients>& c, const Real epsilon = std::numeric_limits<Real>::epsilon()
+) -> std::array<std::complex<Real>, 4>
 {
-    return internal::MonicQuartic<Real>{c[0] / c[4], c[1] / c[4], c[2] / c[4], c[3] / c[4]}.roots(epsilon).to_array();
+    return quartic_roots<Real, std::complex, Coefficients>(c, epsilon);
+}
+
+template <typename Real, typename Coefficients>
+[[nodiscard]] auto quartic_roots_split(const Coefficients& c, const Real epsilon = std::numeric_limits<Real>::epsilon())
+    -> SplitRoots<Real, 4>
+{
+    return internal::MonicQuartic<Real>{c[0] / c[4], c[1] / c[4], c[2] / c[4], c[3] / c[4]}.roots(epsilon).to_split();
 }
 
 template <typename Real, typename Coefficients>
@@ -217,7 +326,7 @@ template <typename Real, typename Coefficients>
 {
     if (c[4] == 0) {
         const auto [cubic_roots, n_roots] = cubic_real_roots<Real>(std::array{c[0], c[1], c[2], c[3]});
-        std::array<Real, 4> roots;
+        std::array<Real, 4> roots{};
         std::copy_n(std::begin(cubic_roots), n_roots, std::begin(roots));
         return {roots, n_roots};
     }
@@ -230,7 +339,7 @@ template <typename Real, typename Coefficients>
 ) -> std::pair<std::array<Real, 4>, std::size_t>
 {
     auto [roots, n_real_roots] = monic_quartic_real_roots<Real>(coefficients, epsilon);
-    std::sort(roots.begin(), roots.begin() + n_real_roots);
+    internal::sort_roots(roots, n_real_roots);
     return {roots, n_real_roots};
 }
 
@@ -240,8 +349,39 @@ quartic_real_roots_sorted(const Coefficients& coefficients, const Real epsilon =
     -> std::pair<std::array<Real, 4>, std::size_t>
 {
     auto [roots, n_real_roots] = quartic_real_roots<Real>(coefficients, epsilon);
-    std::sort(roots.begin(), roots.begin() + n_real_roots);
+    internal::sort_roots(roots, n_real_roots);
     return {roots, n_real_roots};
 }
 
+#define POLYNOMIAL_ROOTS_QUARTIC_TEMPLATES(prefix, Real)                                                               \
+    prefix template struct internal::QuarticRoots<Real>;                                                               \
+    prefix template struct internal::QuarticRealRoots<Real>;                                                           \
+    prefix template class internal::MonicQuartic<Real>;                                                                \
+    prefix template std::array<std::complex<Real>, 4> monic_quartic_roots<Real, std::complex, std::array<Real, 4>>(    \
+        const std::array<Real, 4>&, const Real                                                                         \
+    );                                                                                                                 \
+    prefix template std::array<std::complex<Real>, 4> quartic_roots<Real, std::complex, std::array<Real, 5>>(          \
+        const std::array<Real, 5>&, const Real                                                                         \
+    );                                                                                                                 \
+    prefix template SplitRoots<Real, 4> quartic_roots_split<Real, std::array<Real, 5>>(                                \
+        const std::array<Real, 5>&, const Real                                                                         \
+    );                                                                                                                 \
+    prefix template std::pair<std::array<Real, 4>, std::size_t> monic_quartic_real_roots<Real, std::array<Real, 4>>(   \
+        const std::array<Real, 4>&, const Real                                                                         \
+    );                                                                                                                 \
+    prefix template std::pair<std::array<Real, 4>, std::size_t> quartic_real_roots<Real, std::array<Real, 5>>(         \
+        const std::array<Real, 5>&, const Real                                                                         \
+    );                                                                                                                 \
+    prefix template std::pair<std::array<Real, 4>, std::size_t>                                                        \
+    monic_quartic_real_roots_sorted<Real, std::array<Real, 4>>(const std::array<Real, 4>&, const Real);                \
+    prefix template std::pair<std::array<Real, 4>, std::size_t> quartic_real_roots_sorted<Real, std::array<Real, 5>>(  \
+        const std::array<Real, 5>&, const Real                                                                         \
+    );
+
+#ifdef POLYNOMIAL_ROOTS_EXTERN_TEMPLATES
+POLYNOMIAL_ROOTS_QUARTIC_TEMPLATES(extern, float)
+POLYNOMIAL_ROOTS_QUARTIC_TEMPLATES(extern, double)
+POLYNOMIAL_ROOTS_QUARTIC_TEMPLATES(extern, long double)
+#endif
+
 } // namespace dm::math
@@ -0,0 +1,329 @@
+#pragma once
+
+#include "quartic_roots.hpp"
+#include "small_integral_powers.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace dm::math {
+
+// A quartic surface type `Shape` provides
+//   Real bounding_radius() const -- radius of a sphere about the local origin enclosing the surface
+//   std::array<Real, 5> ray_quartic(const Vector3<Real>& origin, const Vector3<Real>& direction) const
+//                                 -- coefficients in t of the surface equation along origin + t * direction
+// with every ray-independent constant computed once when the shape is constructed.
+
+template <typename RealT>
+struct Vector3
+{
+    using Real = RealT;
+
+    Real x;
+    Real y;
+    Real z;
+
+    [[nodiscard]] Real dot(const Vector3& other) const noexcept
+    {
+        return x * other.x + y * other.y + z * other.z;
+    }
+};
+
+/// torus about the local z axis, centered at the origin
+template <typename RealT>
+class Torus
+{
+  public:
+    using Real = RealT;
+
+    Torus(const Real major_radius, const Real minor_radius) noexcept
+        : major_radius_(major_radius), minor_radius_(minor_radius),
+          four_major_radius_squared_(4 * square(major_radius)),
+          radii_squared_difference_(square(major_radius) - square(minor_radius)),
+          bounding_radius_(major_radius + minor_radius)
+    {}
+
+    [[nodiscard]] Real major_radius() const noexcept
+    {
+        return major_radius_;
+    }
+
+    [[nodiscard]] Real minor_radius() const noexcept
+    {
+        return minor_radius_;
+    }
+
+    [[nodiscard]] Real bounding_radius() const noexcept
+    {
+        return bounding_radius_;
+    }
+
+    /// (|p|^2 + R^2 - r^2)^2 - 4 R^2 (p.x^2 + p.y^2) along p = origin + t * direction
+    [[nodiscard]] std::array<Real, 5> ray_quartic(const Vector3<Real>& o, const Vector3<Real>& d) const noexcept
+    {
+        const auto dd = d.dot(d);
+        const auto od = o.dot(d);
+        const auto g = o.dot(o) + radii_squared_difference_;
+        const auto planar_dd = d.x * d.x + d.y * d.y;
+        const auto planar_od = o.x * d.x + o.y * d.y;
+        const auto planar_oo = o.x * o.x + o.y * o.y;
+        return {
+            g * g - four_major_radius_squared_ * planar_oo,
+            4 * od * g - 2 * four_major_radius_squared_ * planar_od,
+            4 * od * od + 2 * dd * g - four_major_radius_squared_ * planar_dd,
+            4 * dd * od,
+            dd * dd,
+        };
+    }
+
+    /// outward (unnormalized) surface normal at a point on the torus
+    [[nodiscard]] Vector3<Real> normal(const Vector3<Real>& p) const noexcept
+    {
+        const auto g = p.dot(p) + radii_squared_difference_;
+        return {g * p.x - four_major_radius_squared_ / 2 * p.x, g * p.y - four_major_radius_squared_ / 2 * p.y, g * p.z};
+    }
+
+  private:
+    Real major_radius_;
+    Real minor_radius_;
+    Real four_major_radius_squared_;
+    Real radii_squared_difference_;
+    Real bounding_radius_;
+};
+
+namespace internal {
+
+template <typename Real>
+[[nodiscard]] Real evaluate_quartic(const std::array<Real, 5>& c, const Real t) noexcept
+{
+    return (((c[4] * t + c[3]) * t + c[2]) * t + c[1]) * t + c[0];
+}
+
+/// Newton steps on the ray quartic, kept only while they reduce the residual; the closed-form roots lose digits when
+/// the resolvent cubic is ill-conditioned, and near-tangent rays would otherwise be thrown far off by a flat slope
+template <typename Real>
+[[nodiscard]] Real polish_quartic_root(const std::array<Real, 5>& c, Real t) noexcept
+{
+    using std::abs;
+    auto value = evaluate_quartic(c, t);
+    for (int iteration = 0; iteration < 2 && value != 0; ++iteration) {
+        const auto slope = ((4 * c[4] * t + 3 * c[3]) * t + 2 * c[2]) * t + c[1];
+        const auto next = t - value / slope;
+        const auto next_value = evaluate_quartic(c, next);
+        if (!(abs(next_value) < abs(value))) {
+            break;
+        }
+        t = next;
+        value = next_value;
+    }
+    return t;
+}
+
+/// the part of a ray inside a shape's bounding sphere and within `[t_min, t_max]`; `begin > end` for a miss
+template <typename Real>
+struct RaySegment
+{
+    Real begin;
+    Real end;
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return begin > end;
+    }
+};
+
+template <typename Real>
+[[nodiscard]] RaySegment<Real> bounded_segment(
+    const Real bounding_radius,
+    const Vector3<Real>& origin,
+    const Vector3<Real>& direction,
+    const Real t_min,
+    const Real t_max
+) noexcept
+{
+    using std::sqrt;
+    constexpr auto infinity = std::numeric_limits<Real>::infinity();
+    constexpr RaySegment<Real> miss{infinity, -infinity};
+
+    const auto dd = direction.dot(direction);
+    const auto od = origin.dot(direction);
+    const auto discriminant = square(od) - dd * (origin.dot(origin) - square(bounding_radius));
+    if (discriminant < 0) {
+        return miss;
+    }
+    const auto sqrt_discriminant = sqrt(discriminant);
+    const auto t_enter = (-od - sqrt_discriminant) / dd;
+    const auto t_exit = (-od + sqrt_discriminant) / dd;
+    if (t_exit <= t_min || t_enter > t_max) {
+        return miss;
+    }
+    return {(t_enter > t_min) ? t_enter : t_min, (t_exit < t_max) ? t_exit : t_max};
+}
+
+/// Whether the quartic `c` may have a root in `[0, s_max]`. Descartes' rule of signs bounds the number of roots in
+/// `(0, s_max)` by the sign changes of `(1 + w)^4 c(s_max / (1 + w))`; without any, and with neither end a root, the
+/// interval holds none. This rejects most rays that cross the bounding sphere but pass through the hole of a torus or
+/// beside it, for about twenty arithmetic operations.
+template <typename Real>
+[[nodiscard]] bool may_have_root_within(const std::array<Real, 5>& c, const Real s_max) noexcept
+{
+    const auto s2 = s_max * s_max;
+    const std::array<Real, 5> b{c[0], c[1] * s_max, c[2] * s2, c[3] * s2 * s_max, c[4] * s2 * s2};
+    const std::array<Real, 5> w{
+        b[0] + b[1] + b[2] + b[3] + b[4],
+        4 * b[0] + 3 * b[1] + 2 * b[2] + b[3],
+        6 * b[0] + 3 * b[1] + b[2],
+        4 * b[0] + b[1],
+        b[0],
+    };
+    const bool positive = w[0] > 0 && w[1] >= 0 && w[2] >= 0 && w[3] >= 0 && w[4] > 0;
+    const bool negative = w[0] < 0 && w[1] <= 0 && w[2] <= 0 && w[3] <= 0 && w[4] < 0;
+    return !(positive || negative);
+}
+
+/// nearest hit from the ray quartic in `s = t - t0`
+template <typename Real>
+[[nodiscard]] Real
+nearest_root(const std::array<Real, 5>& quartic, const Real t0, const Real t_min, const Real t_max) noexcept
+{
+    const auto [roots, n_roots] = quartic_real_roots<Real>(quartic);
+    auto nearest = std::numeric_limits<Real>::infinity();
+    for (std::size_t i = 0; i < n_roots; ++i) {
+        const auto t = t0 + polish_quartic_root(quartic, roots[i]);
+        if (t > t_min && t <= t_max && t < nearest) {
+            nearest = t;
+        }
+    }
+    return nearest;
+}
+
+} // namespace internal
+
+/// Distance along the ray `origin + t * direction` to the nearest hit on `shape` with `t_min < t <= t_max`, or
+/// infinity for a miss.
+///
+/// Rays missing the bounding sphere, or reaching it only outside `(t_min, t_max]`, are rejected before any quartic is
+/// formed. The quartic is built from the point where the ray enters the bounding sphere, which keeps its coefficients
+/// well scaled for rays starting far from the shape, and rejected when a root bound shows no root within the sphere
+/// and `(t_min, t_max]`. Only its real roots are computed, and candidate roots are polished with Newton steps.
+template <typename Shape, typename Real = typename Shape::Real>
+[[nodiscard]] Real nearest_hit(
+    const Shape& shape,
+    const Vector3<Real>& origin,
+    const Vector3<Real>& direction,
+    const Real t_min = 0,
+    const Real t_max = std::numeric_limits<Real>::infinity()
+) noexcept
+{
+    constexpr auto miss = std::numeric_limits<Real>::infinity();
+
+    const auto segment = internal::bounded_segment(shape.bounding_radius(), origin, direction, t_min, t_max);
+    if (segment.empty()) {
+        return miss;
+    }
+    const auto t0 = segment.begin;
+    const Vector3<Real> start{origin.x + t0 * direction.x, origin.y + t0 * direction.y, origin.z + t0 * direction.z};
+    const auto quartic = shape.ray_quartic(start, direction);
+    if (!internal::may_have_root_within(quartic, segment.end - t0)) {
+        return miss;
+    }
+    return internal::nearest_root(quartic, t0, t_min, t_max);
+}
+
+namespace batch {
+
+/// structure-of-arrays rays in the shape's local frame
+template <typename Real>
+struct RayPacket
+{
+    const Real* origin_x;
+    const Real* origin_y;
+    const Real* origin_z;
+    const Real* direction_x;
+    const Real* direction_y;
+    const Real* direction_z;
+    std::size_t n;
+};
+
+/// Nearest hit distance of every ray in `rays` on `shape`, infinity for misses, equal to `nearest_hit` for each ray.
+///
+/// Rays go through in packets of `packet_size`, one pass per stage: the bounding-sphere test compacts the surviving
+/// rays, their quartic coefficients are built into structure-of-arrays storage in one loop, the root-bound test
+/// compacts them again, and only the remaining quartics are solved.
+template <typename Shape, typename Real = typename Shape::Real>
+void nearest_hits(
+    const Shape& shape,
+    const RayPacket<Real>& rays,
+    Real* t,
+    const Real t_min = 0,
+    const Real t_max = std::numeric_limits<Real>::infinity()
+) noexcept
+{
+    constexpr std::size_t packet_size = 64;
+    constexpr auto miss = std::numeric_limits<Real>::infinity();
+
+    std::array<std::size_t, packet_size> active;
+    std::array<Real, packet_size> t0;
+    std::array<Real, packet_size> s_max;
+    std::array<std::array<Real, packet_size>, 5> coefficients;
+    std::array<std::size_t, packet_size> candidates;
+
+    for (std::size_t first = 0; first < rays.n; first += packet_size) {
+        const auto n_rays = (rays.n - first < packet_size) ? rays.n - first : packet_size;
+
+        std::size_t n_active = 0;
+        for (std::size_t i = first; i < first + n_rays; ++i) {
+            t[i] = miss;
+            const auto segment = internal::bounded_segment(
+                shape.bounding_radius(),
+                Vector3<Real>{rays.origin_x[i], rays.origin_y[i], rays.origin_z[i]},
+                Vector3<Real>{rays.direction_x[i], rays.direction_y[i], rays.direction_z[i]},
+                t_min,
+                t_max
+            );
+            if (!segment.empty()) {
+                active[n_active] = i;
+                t0[n_active] = segment.begin;
+                s_max[n_active] = segment.end - segment.begin;
+                ++n_active;
+            }
+        }
+
+        for (std::size_t k = 0; k < n_active; ++k) {
+            const auto i = active[k];
+            const Vector3<Real> direction{rays.direction_x[i], rays.direction_y[i], rays.direction_z[i]};
+            const Vector3<Real> start{
+                rays.origin_x[i] + t0[k] * direction.x,
+                rays.origin_y[i] + t0[k] * direction.y,
+                rays.origin_z[i] + t0[k] * direction.z,
+            };
+            const auto c = shape.ray_quartic(start, direction);
+            for (std::size_t j = 0; j < 5; ++j) {
+                coefficients[j][k] = c[j];
+            }
+        }
+
+        std::size_t n_candidates = 0;
+        for (std::size_t k = 0; k < n_active; ++k) {
+            const std::array<Real, 5> c{
+                coefficients[0][k], coefficients[1][k], coefficients[2][k], coefficients[3][k], coefficients[4][k]
+            };
+            candidates[n_candidates] = k;
+            n_candidates += internal::may_have_root_within(c, s_max[k]);
+        }
+
+        for (std::size_t m = 0; m < n_candidates; ++m) {
+            const auto k = candidates[m];
+            const std::array<Real, 5> c{
+                coefficients[0][k], coefficients[1][k], coefficients[2][k], coefficients[3][k], coefficients[4][k]
+            };
+            t[active[k]] = internal::nearest_root(c, t0[k], t_min, t_max);
+        }
+    }
+}
+
+} // namespace batch
+
+} // namespace dm::math
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "cubic_roots.hpp"
+#include "quadratic_roots.hpp"
+#include "quartic_roots.hpp"
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+namespace dm::math {
+
+// Sensitivities of the roots of p(x) = sum_k c[k] * x^k to its coefficients. Differentiating p(r) = 0 gives
+// dr/dc[k] = -r^k / p'(r) at every simple root r, so the Jacobian costs one derivative evaluation per root instead of
+// a solve per perturbed coefficient. At repeated roots p'(r) = 0 and the entries are not finite.
+
+template <typename Root, std::size_t Degree>
+struct RootsWithJacobian
+{
+    std::array<Root, Degree> roots;
+    /// jacobian[j][k] = d roots[j] / d c[k]
+    std::array<std::array<Root, Degree + 1>, Degree> jacobian;
+};
+
+template <typename Real, std::size_t Degree>
+struct RealRootsWithJacobian
+{
+    std::array<Real, Degree> roots;
+    std::size_t n_roots;
+    /// jacobian[j][k] = d roots[j] / d c[k] for j < n_roots
+    std::array<std::array<Real, Degree + 1>, Degree> jacobian;
+};
+
+namespace internal {
+
+/// d root / d c[k] for every coefficient of the polynomial `c` of degree `N - 1`
+template <typename Root, typename Coefficients, std::size_t N = std::tuple_size<Coefficients>::value>
+[[nodiscard]] std::array<Root, N> root_gradient(const Coefficients& c, const Root& root) noexcept
+{
+    Root derivative = 0;
+    for (std::size_t k = N - 1; k > 0; --k) {
+        derivative = derivative * root + static_cast<Root>(c[k]) * static_cast<Root>(k);
+    }
+    std::array<Root, N> gradient;
+    Root power = 1;
+    for (std::size_t k = 0; k < N; ++k) {
+        gradient[k] = -power / derivative;
+        power *= root;
+    }
+    return gradient;
+}
+
+template <typename Root, std::size_t Degree, typename Coefficients>
+[[nodiscard]] RootsWithJacobian<Root, Degree>
+with_jacobian(const std::array<Root, Degree>& roots, const Coefficients& c) noexcept
+{
+    RootsWithJacobian<Root, Degree> result{roots, {}};
+    for (std::size_t j = 0; j < Degree; ++j) {
+        result.jacobian[j] = root_gradient<Root>(c, roots[j]);
+    }
+    return result;
+}
+
+} // namespace internal
+
+template <typename Real>
+[[nodiscard]] RealRootsWithJacobian<Real, 2> quadratic_real_roots_with_jacobian(const std::array<Real, 3>& c) noexcept
+{
+    const auto [roots, n_roots] = quadratic_real_roots(c);
+    RealRootsWithJacobian<Real, 2> result{roots, n_roots, {}};
+    for (std::size_t j = 0; j < n_roots; ++j) {
+        result.jacobian[j] = internal::root_gradient<Real>(c, roots[j]);
+    }
+    return result;
+}
+
+template <typename Real>
+[[nodiscard]] RootsWithJacobian<std::complex<Real>, 3> cubic_roots_with_jacobian(const std::array<Real, 4>& c) noexcept
+{
+    return internal::with_jacobian(cubic_roots<Real>(c), c);
+}
+
+template <typename Real>
+[[nodiscard]] RootsWithJacobian<std::complex<Real>, 4>
+quartic_roots_with_jacobian(const std::array<Real, 5>& c, const Real epsilon = std::numeric_limits<Real>::epsilon())
+    noexcept
+{
+    return internal::with_jacobian(quartic_roots<Real>(c, epsilon), c);
+}
+
+} // namespace dm::math
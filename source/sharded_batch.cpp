@@ -0,0 +1,303 @@
+#include "sharded_batch.hpp"
+
+#include "batch_roots.hpp"
+
+#include <signal.h>
+#include <sys/mman.h>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dm::math::sharded {
+
+namespace {
+
+using ShardState = std::atomic<std::uint32_t>;
+
+constexpr std::uint32_t shard_pending = 0;
+constexpr std::uint32_t shard_done = std::numeric_limits<std::uint32_t>::max();
+
+static_assert(ShardState::is_always_lock_free, "shard states must be usable across processes");
+static_assert(std::atomic<std::size_t>::is_always_lock_free, "shard cursor must be usable across processes");
+
+[[noreturn]] void throw_errno(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/// shard queue living at the start of a shared mapping, followed by one state per shard
+class WorkQueue
+{
+  public:
+    explicit WorkQueue(const std::size_t n_shards)
+        : mapping_(sizeof(std::atomic<std::size_t>) + n_shards * sizeof(ShardState)), n_shards_(n_shards)
+    {
+        new (mapping_.data()) std::atomic<std::size_t>{0};
+        for (std::size_t shard = 0; shard < n_shards_; ++shard) {
+            new (&state(shard)) ShardState{shard_pending};
+        }
+    }
+
+    [[nodiscard]] std::size_t n_shards() const noexcept
+    {
+        return n_shards_;
+    }
+
+    [[nodiscard]] ShardState& state(const std::size_t shard) const noexcept
+    {
+        return reinterpret_cast<ShardState*>(static_cast<std::atomic<std::size_t>*>(mapping_.data()) + 1)[shard];
+    }
+
+    /// claims the next pending shard for `owner`, returning `n_shards()` when none is left
+    [[nodiscard]] std::size_t claim(const std::uint32_t owner) const noexcept
+    {
+        auto& cursor = *static_cast<std::atomic<std::size_t>*>(mapping_.data());
+        for (auto shard = cursor.fetch_add(1); shard < n_shards_; shard = cursor.fetch_add(1)) {
+            if (try_claim(shard, owner)) {
+                return shard;
+            }
+        }
+        // shards released by failed workers sit behind the cursor
+        for (std::size_t shard = 0; shard < n_shards_; ++shard) {
+            if (try_claim(shard, owner)) {
+                return shard;
+            }
+        }
+        return n_shards_;
+    }
+
+    /// returns every shard still claimed by `owner` to the queue
+    std::size_t release(const std::uint32_t owner) const noexcept
+    {
+        std::size_t n_released = 0;
+        for (std::size_t shard = 0; shard < n_shards_; ++shard) {
+            auto expected = owner;
+            n_released += state(shard).compare_exchange_strong(expected, shard_pending);
+        }
+        return n_released;
+    }
+
+  private:
+    SharedMapping mapping_;
+    std::size_t n_shards_;
+
+    [[nodiscard]] bool try_claim(const std::size_t shard, const std::uint32_t owner) const noexcept
+    {
+        auto expected = shard_pending;
+        return state(shard).compare_exchange_strong(expected, owner);
+    }
+};
+
+struct ShardBatch
+{
+    const double* coefficients;
+    std::size_t n;
+
+    [[nodiscard]] const double* operator[](const std::size_t i) const noexcept
+    {
+        return coefficients + 5 * i;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return n;
+    }
+};
+
+void solve_shard(
+    const double* coefficients,
+    const std::size_t n,
+    const SharedQuarticRoots& roots,
+    const std::size_t shard_size,
+    const std::size_t shard
+)
+{
+    const auto begin = shard * shard_size;
+    const auto count = std::min(shard_size, n - begin);
+    batch::quartic_roots<double>(
+        ShardBatch{coefficients + 5 * begin, count},
+        std::array{roots.real(0) + begin, roots.real(1) + begin, roots.real(2) + begin, roots.real(3) + begin},
+        std::array{roots.imag(0) + begin, roots.imag(1) + begin, roots.imag(2) + begin, roots.imag(3) + begin}
+    );
+}
+
+/// The whole body of a worker process; a throwing `before_shard` ends the worker like a crash, so that its shards go
+/// through the restart path instead of unwinding into the caller's stack in the child. Workers sit outside the
+/// caller's process group, so terminal signals never reach them; they die with the coordinator instead, by
+/// `PR_SET_PDEATHSIG` where there is one and by checking for a new parent between shards everywhere.
+[[noreturn]] void run_worker(
+    const double* coefficients,
+    const std::size_t n,
+    const SharedQuarticRoots& roots,
+    const WorkQueue& queue,
+    const ShardOptions& options,
+    const std::uint32_t owner,
+    const pid_t coordinator
+) noexcept
+{
+#ifdef __linux__
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+    try {
+        for (auto shard = queue.claim(owner); shard < queue.n_shards(); shard = queue.claim(owner)) {
+            if (getppid() != coordinator) {
+                // the coordinator died, possibly before the death signal was armed; leave the shard claimed
+                _exit(1);
+            }
+            if (options.before_shard) {
+                options.before_shard(shard);
+            }
+            solve_shard(coefficients, n, roots, options.shard_size, shard);
+            queue.state(shard).store(shard_done);
+        }
+    } catch (...) {
+        _exit(1);
+    }
+    _exit(0);
+}
+
+/// kills and reaps the workers still running, for when the coordinator cannot carry on
+void abandon_workers(std::vector<pid_t>& workers) noexcept
+{
+    for (auto& pid : workers) {
+        if (pid > 0) {
+            kill(pid, SIGKILL);
+            while (waitpid(pid, nullptr, 0) < 0 && errno == EINTR) {
+            }
+            pid = -1;
+        }
+    }
+}
+
+} // namespace
+
+SharedMapping::SharedMapping(const std::size_t bytes) : data_(nullptr), size_(bytes)
+{
+    if (size_ == 0) {
+        return;
+    }
+    data_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (data_ == MAP_FAILED) {
+        throw_errno("mmap");
+    }
+}
+
+SharedMapping::SharedMapping(SharedMapping&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+{}
+
+SharedMapping& SharedMapping::operator=(SharedMapping&& other) noexcept
+{
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    return *this;
+}
+
+SharedMapping::~SharedMapping()
+{
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+}
+
+SharedQuarticRoots::SharedQuarticRoots(const std::size_t n) : n_(n), mapping_(8 * n * sizeof(double)) {}
+
+ShardReport solve_quartics(
+    const double* coefficients, const std::size_t n, const SharedQuarticRoots& roots, const ShardOptions& options
+)
+{
+    const auto shard_size = std::max<std::size_t>(options.shard_size, 1);
+    const WorkQueue queue{(n + shard_size - 1) / shard_size};
+    const auto n_workers = std::min<std::size_t>(
+        (options.n_workers != 0) ? options.n_workers : std::max(1u, std::thread::hardware_concurrency()),
+        queue.n_shards()
+    );
+
+    ShardOptions worker_options = options;
+    worker_options.shard_size = shard_size;
+
+    ShardReport report{queue.n_shards(), 0, 0, 0};
+    const auto coordinator = getpid();
+    std::vector<pid_t> workers(n_workers, -1);
+    // Workers share a process group of their own so that the coordinator can wait on exactly them with
+    // waitpid(-group) and never reaps other children of the host process. The group lives while any worker, running
+    // or not yet reaped, is in it; a worker spawned when none is left starts a new one.
+    pid_t group = 0;
+    std::size_t n_running = 0;
+    const auto spawn = [&](const std::size_t slot) {
+        const auto worker_group = (n_running > 0) ? group : 0;
+        const auto pid = fork();
+        if (pid < 0) {
+            throw_errno("fork");
+        }
+        if (pid == 0) {
+            setpgid(0, worker_group);
+            run_worker(
+                coefficients, n, roots, queue, worker_options, static_cast<std::uint32_t>(slot + 1), coordinator
+            );
+        }
+        // also set from the parent so that the group is in place before waitpid(-group) whichever process runs first
+        setpgid(pid, worker_group);
+        group = (worker_group != 0) ? worker_group : pid;
+        workers[slot] = pid;
+        ++n_running;
+        ++report.n_workers_spawned;
+    };
+
+    try {
+        for (std::size_t slot = 0; slot < n_workers; ++slot) {
+            spawn(slot);
+        }
+
+        std::size_t n_restarts = 0;
+        while (n_running > 0) {
+            int status = 0;
+            const auto pid = waitpid(-group, &status, 0);
+            if (pid < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw_errno("waitpid");
+            }
+            const auto slot =
+                static_cast<std::size_t>(std::find(workers.begin(), workers.end(), pid) - workers.begin());
+            workers[slot] = -1;
+            --n_running;
+            if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+                continue;
+            }
+            ++report.n_worker_failures;
+            if (queue.release(static_cast<std::uint32_t>(slot + 1)) > 0 && n_restarts < options.max_restarts) {
+                ++n_restarts;
+                spawn(slot);
+            }
+        }
+    } catch (...) {
+        abandon_workers(workers);
+        throw;
+    }
+
+    for (std::size_t shard = 0; shard < queue.n_shards(); ++shard) {
+        if (queue.state(shard).load() != shard_done) {
+            solve_shard(coefficients, n, roots, shard_size, shard);
+            queue.state(shard).store(shard_done);
+            ++report.n_shards_solved_by_coordinator;
+        }
+    }
+    return report;
+}
+
+} // namespace dm::math::sharded
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace dm::math::sharded {
+
+/// anonymous `MAP_SHARED` memory that stays visible to forked worker processes
+class SharedMapping
+{
+  public:
+    explicit SharedMapping(std::size_t bytes);
+    SharedMapping(SharedMapping&& other) noexcept;
+    SharedMapping& operator=(SharedMapping&& other) noexcept;
+    SharedMapping(const SharedMapping&) = delete;
+    SharedMapping& operator=(const SharedMapping&) = delete;
+    ~SharedMapping();
+
+    [[nodiscard]] void* data() const noexcept
+    {
+        return data_;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+  private:
+    void* data_;
+    std::size_t size_;
+};
+
+/// split real/imaginary roots of `n` quartics in shared memory; `real(j)[i]` is root j of polynomial i
+class SharedQuarticRoots
+{
+  public:
+    explicit SharedQuarticRoots(std::size_t n);
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return n_;
+    }
+
+    [[nodiscard]] double* real(std::size_t j) const noexcept
+    {
+        return static_cast<double*>(mapping_.data()) + j * n_;
+    }
+
+    [[nodiscard]] double* imag(std::size_t j) const noexcept
+    {
+        return static_cast<double*>(mapping_.data()) + (4 + j) * n_;
+    }
+
+  private:
+    std::size_t n_;
+    SharedMapping mapping_;
+};
+
+struct ShardOptions
+{
+    /// worker processes to spawn, 0 for one per hardware thread
+    std::size_t n_workers = 0;
+    /// polynomials per shard
+    std::size_t shard_size = std::size_t{1} << 16;
+    /// replacement workers spawned after abnormal worker exits
+    std::size_t max_restarts = 4;
+    /// called in the worker process before each shard is solved; for tests and instrumentation
+    std::function<void(std::size_t shard)> before_shard;
+};
+
+struct ShardReport
+{
+    std::size_t n_shards;
+    std::size_t n_workers_spawned;
+    std::size_t n_worker_failures;
+    /// shards left over after the restart budget was spent and solved by the coordinator itself
+    std::size_t n_shards_solved_by_coordinator;
+};
+
+/// Solves `n` quartics with coefficients `coefficients[5 * i + j]` (lowest degree first) in forked worker processes.
+///
+/// Workers claim shards through a lock-free queue in shared memory and write directly into `roots`. Shards held by a
+/// worker that exits abnormally, or whose `before_shard` throws, are returned to the queue and a replacement worker is
+/// spawned. Workers run in a process group of their own, so the coordinator reaps only its own workers and leaves other
+/// children of the caller alone; terminal signals to the caller's group do not reach them, but workers are killed when
+/// the calling thread or process dies. Throws `std::system_error` when the shared mapping or a process cannot be
+/// created, after killing and reaping the workers already started.
+///
+/// Must not be called from a multithreaded process: each worker is a `fork` of the caller that allocates and runs
+/// `before_shard`, which can deadlock on a lock another thread held at the fork.
+ShardReport solve_quartics(
+    const double* coefficients, std::size_t n, const SharedQuarticRoots& roots, const ShardOptions& options = {}
+);
+
+} // namespace dm::math::sharded
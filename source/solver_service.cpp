@@ -0,0 +1,534 @@
+#include "solver_service.hpp"
+
+#include "batch_roots.hpp"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dm::math::service {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+#ifdef MSG_NOSIGNAL
+constexpr int send_flags = MSG_NOSIGNAL;
+#else
+constexpr int send_flags = 0;
+#endif
+
+/// bytes read from one connection per wakeup, so that a fast sender cannot starve the others
+constexpr std::size_t max_read = std::size_t{1} << 20;
+
+[[noreturn]] void throw_errno(const int error, const char* what)
+{
+    throw std::system_error(error, std::generic_category(), what);
+}
+
+[[noreturn]] void throw_errno(const char* what)
+{
+    throw_errno(errno, what);
+}
+
+void close_if_open(const int fd) noexcept
+{
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+/// sets close-on-exec and, unless the descriptor is used blockingly, non-blocking mode; no SIGPIPE where supported
+bool configure_descriptor(const int fd, const bool non_blocking) noexcept
+{
+    if (fcntl(fd, F_SETFD, FD_CLOEXEC) < 0) {
+        return false;
+    }
+    if (non_blocking && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0) {
+        return false;
+    }
+#ifdef SO_NOSIGPIPE
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+    return true;
+}
+
+[[nodiscard]] sockaddr_un socket_address(const std::string& path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        throw_errno(ENAMETOOLONG, "socket path");
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+[[nodiscard]] bool accepts_connections(const sockaddr_un& address) noexcept
+{
+    const auto probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0) {
+        return false;
+    }
+    const auto connected = connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    close(probe);
+    return connected;
+}
+
+template <typename T>
+void append_bytes(std::vector<unsigned char>& bytes, const T* values, const std::size_t n)
+{
+    const auto* begin = reinterpret_cast<const unsigned char*>(values);
+    bytes.insert(bytes.end(), begin, begin + n * sizeof(T));
+}
+
+struct Connection
+{
+    int fd;
+    std::vector<unsigned char> in;
+    std::vector<unsigned char> out;
+    std::size_t n_sent = 0;
+    /// requests in the current batch
+    std::size_t n_pending = 0;
+    /// the client shut down its sending side; the connection stays until the pending replies are sent
+    bool end_of_input = false;
+    /// the connection failed or broke the protocol and is dropped without further replies
+    bool closed = false;
+
+    /// whether nothing more will be sent or received on the connection
+    [[nodiscard]] bool finished() const noexcept
+    {
+        return closed || (end_of_input && n_pending == 0 && out.empty());
+    }
+};
+
+struct PendingRequest
+{
+    std::uint64_t connection;
+    std::size_t begin;
+    std::size_t n;
+};
+
+/// rows of a flat coefficient buffer, as a `batch` argument
+struct CoefficientRows
+{
+    const double* coefficients;
+    std::size_t n;
+
+    [[nodiscard]] const double* operator[](const std::size_t i) const noexcept
+    {
+        return coefficients + 5 * i;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return n;
+    }
+};
+
+/// reads what is available, at most `max_bytes`; notes the end of input on end of file and marks the connection closed
+/// on error
+void receive(Connection& connection, std::size_t max_bytes)
+{
+    std::array<unsigned char, 1 << 16> buffer;
+    while (max_bytes > 0) {
+        const auto n_read = recv(connection.fd, buffer.data(), std::min(buffer.size(), max_bytes), 0);
+        if (n_read > 0) {
+            connection.in.insert(connection.in.end(), buffer.begin(), buffer.begin() + n_read);
+            max_bytes -= static_cast<std::size_t>(n_read);
+            continue;
+        }
+        if (n_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n_read == 0) {
+            connection.end_of_input = true;
+        } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            connection.closed = true;
+        }
+        return;
+    }
+}
+
+/// writes what the socket accepts; marks the connection closed on error
+void transmit(Connection& connection) noexcept
+{
+    while (connection.n_sent < connection.out.size()) {
+        const auto n_written = send(
+            connection.fd, connection.out.data() + connection.n_sent, connection.out.size() - connection.n_sent,
+            send_flags
+        );
+        if (n_written >= 0) {
+            connection.n_sent += static_cast<std::size_t>(n_written);
+            continue;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            connection.closed = true;
+        }
+        return;
+    }
+    connection.out.clear();
+    connection.n_sent = 0;
+}
+
+/// waits for `fds` up to `timeout`, or indefinitely for a negative timeout
+int wait_for(std::vector<pollfd>& fds, const std::chrono::microseconds timeout)
+{
+#ifdef __linux__
+    if (timeout.count() >= 0) {
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+        const timespec ts{
+            static_cast<time_t>(seconds.count()), static_cast<long>((timeout - seconds).count() * 1000)
+        };
+        return ppoll(fds.data(), fds.size(), &ts, nullptr);
+    }
+    return ppoll(fds.data(), fds.size(), nullptr, nullptr);
+#else
+    // poll has millisecond resolution, so budgets round up to the next millisecond
+    const auto ms = (timeout.count() >= 0) ? static_cast<int>((timeout.count() + 999) / 1000) : -1;
+    return poll(fds.data(), fds.size(), ms);
+#endif
+}
+
+void send_all(const int fd, const void* data, const std::size_t bytes)
+{
+    const auto* begin = static_cast<const unsigned char*>(data);
+    for (std::size_t n_sent = 0; n_sent < bytes;) {
+        const auto n_written = send(fd, begin + n_sent, bytes - n_sent, send_flags);
+        if (n_written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_errno("send");
+        }
+        n_sent += static_cast<std::size_t>(n_written);
+    }
+}
+
+void receive_all(const int fd, void* data, const std::size_t bytes)
+{
+    auto* begin = static_cast<unsigned char*>(data);
+    for (std::size_t n_received = 0; n_received < bytes;) {
+        const auto n_read = recv(fd, begin + n_received, bytes - n_received, 0);
+        if (n_read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_errno("recv");
+        }
+        if (n_read == 0) {
+            throw_errno(ECONNRESET, "recv");
+        }
+        n_received += static_cast<std::size_t>(n_read);
+    }
+}
+
+} // namespace
+
+Server::Server(ServerOptions options)
+    : options_(std::move(options)),
+      listener_(-1),
+      wake_pipe_{-1, -1},
+      n_connections_(0),
+      n_requests_(0),
+      n_polynomials_(0),
+      n_batches_(0),
+      largest_batch_(0)
+{
+    const auto address = socket_address(options_.socket_path);
+    const auto fail = [this](const char* what) {
+        const auto error = errno;
+        close_if_open(listener_);
+        close_if_open(wake_pipe_[0]);
+        close_if_open(wake_pipe_[1]);
+        throw_errno(error, what);
+    };
+
+    // only a socket left behind by a server that is gone is replaced, never a live one or another kind of file
+    struct stat status;
+    if (lstat(options_.socket_path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode)) {
+        if (accepts_connections(address)) {
+            throw_errno(EADDRINUSE, "bind");
+        }
+        unlink(options_.socket_path.c_str());
+    }
+
+    listener_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener_ < 0 || !configure_descriptor(listener_, true)) {
+        fail("socket");
+    }
+    if (bind(listener_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0) {
+        fail("bind");
+    }
+    if (listen(listener_, SOMAXCONN) < 0) {
+        fail("listen");
+    }
+    if (pipe(wake_pipe_) < 0 || !configure_descriptor(wake_pipe_[0], true) ||
+        !configure_descriptor(wake_pipe_[1], true)) {
+        fail("pipe");
+    }
+}
+
+Server::~Server()
+{
+    close_if_open(listener_);
+    close_if_open(wake_pipe_[0]);
+    close_if_open(wake_pipe_[1]);
+    unlink(options_.socket_path.c_str());
+}
+
+void Server::stop() noexcept
+{
+    const unsigned char byte = 1;
+    [[maybe_unused]] const auto n_written = write(wake_pipe_[1], &byte, 1);
+}
+
+ServerStats Server::stats() const noexcept
+{
+    return {
+        n_connections_.load(std::memory_order_relaxed),
+        n_requests_.load(std::memory_order_relaxed),
+        n_polynomials_.load(std::memory_order_relaxed),
+        n_batches_.load(std::memory_order_relaxed),
+        largest_batch_.load(std::memory_order_relaxed),
+    };
+}
+
+void Server::run()
+{
+    std::unordered_map<std::uint64_t, Connection> connections;
+    std::uint64_t next_connection = 0;
+
+    std::vector<double> coefficients;
+    std::vector<PendingRequest> pending;
+    std::array<std::vector<double>, 4> real;
+    std::array<std::vector<double>, 4> imag;
+    Clock::time_point deadline;
+
+    const auto relaxed_add = [](std::atomic<std::size_t>& counter, const std::size_t n) {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    };
+    const auto max_request = std::min<std::size_t>(options_.max_request, UINT32_MAX);
+    const auto max_output = options_.max_output;
+    // parsing consumes every complete request, so a connection buffers at most one incomplete request
+    const auto max_input = sizeof(MessageHeader) + 5 * max_request * sizeof(double);
+
+    // moves every complete request of `connection` into the batch, closing it on a malformed header
+    const auto parse_requests = [&](const std::uint64_t id, Connection& connection) {
+        std::size_t consumed = 0;
+        while (connection.in.size() - consumed >= sizeof(MessageHeader)) {
+            MessageHeader header;
+            std::memcpy(&header, connection.in.data() + consumed, sizeof(header));
+            if (header.magic != request_magic || header.n > max_request) {
+                connection.closed = true;
+                return;
+            }
+            const auto bytes = sizeof(header) + 5 * header.n * sizeof(double);
+            if (connection.in.size() - consumed < bytes) {
+                break;
+            }
+            if (pending.empty()) {
+                deadline = Clock::now() + options_.latency_budget;
+            }
+            pending.push_back({id, coefficients.size() / 5, header.n});
+            ++connection.n_pending;
+            const auto begin = coefficients.size();
+            coefficients.resize(begin + 5 * header.n);
+            std::memcpy(coefficients.data() + begin, connection.in.data() + consumed + sizeof(header), bytes - sizeof(header));
+            consumed += bytes;
+        }
+        connection.in.erase(connection.in.begin(), connection.in.begin() + static_cast<std::ptrdiff_t>(consumed));
+    };
+
+    const auto solve_batch = [&] {
+        const auto n = coefficients.size() / 5;
+        for (std::size_t j = 0; j < 4; ++j) {
+            real[j].resize(n);
+            imag[j].resize(n);
+        }
+        batch::quartic_roots<double>(
+            CoefficientRows{coefficients.data(), n}, std::array{real[0].data(), real[1].data(), real[2].data(), real[3].data()},
+            std::array{imag[0].data(), imag[1].data(), imag[2].data(), imag[3].data()}
+        );
+
+        std::vector<double> roots;
+        for (const auto& request : pending) {
+            const auto connection = connections.find(request.connection);
+            if (connection == connections.end()) {
+                continue;
+            }
+            --connection->second.n_pending;
+            if (connection->second.closed) {
+                continue;
+            }
+            auto& out = connection->second.out;
+            const MessageHeader header{response_magic, static_cast<std::uint32_t>(request.n)};
+            append_bytes(out, &header, 1);
+            roots.resize(4 * request.n);
+            for (const auto* parts : {&real, &imag}) {
+                for (std::size_t i = 0; i < request.n; ++i) {
+                    for (std::size_t j = 0; j < 4; ++j) {
+                        roots[4 * i + j] = (*parts)[j][request.begin + i];
+                    }
+                }
+                append_bytes(out, roots.data(), roots.size());
+            }
+            transmit(connection->second);
+        }
+
+        relaxed_add(n_requests_, pending.size());
+        relaxed_add(n_polynomials_, n);
+        relaxed_add(n_batches_, 1);
+        largest_batch_.store(std::max(largest_batch_.load(std::memory_order_relaxed), n), std::memory_order_relaxed);
+        coefficients.clear();
+        pending.clear();
+    };
+
+    std::vector<pollfd> fds;
+    std::vector<std::uint64_t> fd_connections;
+    std::vector<bool> fd_reading;
+    bool stopping = false;
+    while (!stopping) {
+        fds.assign({{wake_pipe_[0], POLLIN, 0}, {listener_, POLLIN, 0}});
+        fd_connections.clear();
+        fd_reading.clear();
+        for (const auto& [id, connection] : connections) {
+            // a client that does not read its replies is not read from either, so that its requests wait in the
+            // socket buffers instead of daemon memory
+            const auto reading = !connection.end_of_input && connection.in.size() < max_input &&
+                                 connection.out.size() - connection.n_sent <= max_output;
+            const short events = (reading ? POLLIN : 0) | (connection.out.empty() ? 0 : POLLOUT);
+            fds.push_back({connection.fd, events, 0});
+            fd_connections.push_back(id);
+            fd_reading.push_back(reading);
+        }
+        const auto timeout =
+            pending.empty() ? std::chrono::microseconds{-1}
+                            : std::max(
+                                  std::chrono::microseconds{0},
+                                  std::chrono::ceil<std::chrono::microseconds>(deadline - Clock::now())
+                              );
+        if (wait_for(fds, timeout) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_errno("poll");
+        }
+
+        if (fds[0].revents != 0) {
+            stopping = true;
+            std::array<unsigned char, 64> drained;
+            while (read(wake_pipe_[0], drained.data(), drained.size()) > 0) {
+            }
+        }
+        if (fds[1].revents != 0) {
+            for (auto fd = accept(listener_, nullptr, nullptr); fd >= 0; fd = accept(listener_, nullptr, nullptr)) {
+                if (!configure_descriptor(fd, true)) {
+                    close(fd);
+                    continue;
+                }
+                connections.emplace(next_connection++, Connection{fd, {}, {}});
+                relaxed_add(n_connections_, 1);
+            }
+        }
+        for (std::size_t k = 2; k < fds.size(); ++k) {
+            const auto id = fd_connections[k - 2];
+            auto& connection = connections.at(id);
+            if ((fds[k].revents & POLLOUT) != 0) {
+                transmit(connection);
+            }
+            const auto reading = fd_reading[k - 2];
+            if ((fds[k].revents & (POLLIN | POLLHUP | POLLERR)) != 0 && reading) {
+                receive(connection, std::min(max_read, max_input - connection.in.size()));
+                parse_requests(id, connection);
+            }
+            if ((fds[k].revents & (POLLHUP | POLLERR)) != 0 && (connection.end_of_input || !reading)) {
+                // the client is gone altogether rather than only done sending, so replies cannot be delivered, and
+                // the requests of one that was not being read are dropped unread
+                connection.closed = true;
+            }
+        }
+
+        if (!pending.empty() && (coefficients.size() / 5 >= options_.max_batch || Clock::now() >= deadline)) {
+            solve_batch();
+        }
+        for (auto connection = connections.begin(); connection != connections.end();) {
+            if (connection->second.finished()) {
+                close(connection->second.fd);
+                connection = connections.erase(connection);
+            } else {
+                ++connection;
+            }
+        }
+    }
+
+    if (!pending.empty()) {
+        solve_batch();
+    }
+    for (auto& [id, connection] : connections) {
+        close(connection.fd);
+    }
+}
+
+Client::Client(const std::string& socket_path) : socket_(socket(AF_UNIX, SOCK_STREAM, 0))
+{
+    if (socket_ < 0) {
+        throw_errno("socket");
+    }
+    const auto address = socket_address(socket_path);
+    if (!configure_descriptor(socket_, false) ||
+        connect(socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0) {
+        const auto error = errno;
+        close(socket_);
+        throw_errno(error, "connect");
+    }
+}
+
+Client::Client(Client&& other) noexcept : socket_(std::exchange(other.socket_, -1)) {}
+
+Client& Client::operator=(Client&& other) noexcept
+{
+    std::swap(socket_, other.socket_);
+    return *this;
+}
+
+Client::~Client()
+{
+    close_if_open(socket_);
+}
+
+void Client::solve_quartics(const double* coefficients, const std::size_t n, double* roots_real, double* roots_imag)
+{
+    if (n > UINT32_MAX) {
+        throw_errno(EMSGSIZE, "solve_quartics");
+    }
+    const MessageHeader request{request_magic, static_cast<std::uint32_t>(n)};
+    send_all(socket_, &request, sizeof(request));
+    send_all(socket_, coefficients, 5 * n * sizeof(double));
+
+    MessageHeader response;
+    receive_all(socket_, &response, sizeof(response));
+    if (response.magic != response_magic || response.n != n) {
+        throw_errno(EPROTO, "solve_quartics");
+    }
+    receive_all(socket_, roots_real, 4 * n * sizeof(double));
+    receive_all(socket_, roots_imag, 4 * n * sizeof(double));
+}
+
+} // namespace dm::math::service
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace dm::math::service {
+
+// A local solver daemon for hosts running many small processes that each solve a few quartics at a time: clients
+// send coefficient batches over a Unix domain stream socket, the server coalesces the requests of all clients into
+// one batch for up to a latency budget, solves it with `batch::quartic_roots` and answers each client in order.
+//
+// Wire format, native byte order since both ends share a host: a request is a `MessageHeader` with the polynomial
+// count followed by 5 doubles per polynomial (lowest degree first); the response is a `MessageHeader` with the same
+// count followed by the 4n real parts and then the 4n imaginary parts of the roots, root j of polynomial i at 4i + j.
+// A client may pipeline requests and may shut down its sending side after the last one; its replies still follow.
+
+struct MessageHeader
+{
+    std::uint32_t magic;
+    std::uint32_t n;
+};
+
+inline constexpr std::uint32_t request_magic = 0x51525131;  // "QRQ1"
+inline constexpr std::uint32_t response_magic = 0x51525331; // "QRS1"
+
+struct ServerOptions
+{
+    std::string socket_path;
+    /// longest time a request waits for other requests to join its batch
+    std::chrono::microseconds latency_budget{200};
+    /// polynomials per batch that trigger solving before the budget is spent
+    std::size_t max_batch = std::size_t{1} << 14;
+    /// larger requests are rejected by closing the connection; one request of this size also bounds the unparsed bytes
+    /// buffered per connection
+    std::size_t max_request = std::size_t{1} << 20;
+    /// reply bytes buffered for a client that is not reading them, beyond which its requests are left unread
+    std::size_t max_output = std::size_t{1} << 24;
+};
+
+struct ServerStats
+{
+    std::size_t n_connections;
+    std::size_t n_requests;
+    std::size_t n_polynomials;
+    std::size_t n_batches;
+    std::size_t largest_batch;
+};
+
+/// single-threaded `poll` loop serving `ServerOptions::socket_path`
+class Server
+{
+  public:
+    /// binds and listens on the socket, replacing the socket file of a server that is no longer running; throws
+    /// `std::system_error` on failure, with `EADDRINUSE` if another server is listening
+    explicit Server(ServerOptions options);
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+    /// closes every connection and removes the socket file
+    ~Server();
+
+    /// serves clients until `stop` is called; throws `std::system_error` if polling fails
+    void run();
+
+    /// makes `run` return; requests already received are solved and answered as far as the sockets accept without
+    /// blocking before the connections are closed. Async-signal-safe and callable from any thread.
+    void stop() noexcept;
+
+    /// counters of the current or last `run`; read them after it returns or accept torn values
+    [[nodiscard]] ServerStats stats() const noexcept;
+
+  private:
+    ServerOptions options_;
+    int listener_;
+    int wake_pipe_[2];
+    std::atomic<std::size_t> n_connections_;
+    std::atomic<std::size_t> n_requests_;
+    std::atomic<std::size_t> n_polynomials_;
+    std::atomic<std::size_t> n_batches_;
+    std::atomic<std::size_t> largest_batch_;
+};
+
+/// blocking connection to a `Server`
+class Client
+{
+  public:
+    /// throws `std::system_error` if the socket cannot be connected
+    explicit Client(const std::string& socket_path);
+    Client(Client&& other) noexcept;
+    Client& operator=(Client&& other) noexcept;
+    Client(const Client&) = delete;
+    Client& operator=(const Client&) = delete;
+    ~Client();
+
+    /// Solves `n` quartics with coefficients `coefficients[5 * i + k]` on the server, writing root j of polynomial i to
+    /// `roots_real[4 * i + j]` and `roots_imag[4 * i + j]`. Throws `std::system_error` if the connection fails or the
+    /// server rejects the request.
+    void solve_quartics(const double* coefficients, std::size_t n, double* roots_real, double* roots_imag);
+
+  private:
+    int socket_;
+};
+
+} // namespace dm::math::service
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+
+namespace dm::math {
+
+/// complex number with textbook arithmetic and none of `std::complex`'s recovery of infinities and NaNs, so that
+/// operations on it compile to plain multiplies and adds that vectorize; usable as the `Complex` parameter of the
+/// solvers. Products and quotients of values near the overflow threshold overflow where `std::complex` would not.
+template <typename RealT>
+struct SimpleComplex
+{
+    using value_type = RealT;
+
+    RealT re;
+    RealT im;
+
+    constexpr SimpleComplex() noexcept : re(0), im(0) {}
+    constexpr SimpleComplex(const RealT real, const RealT imag = 0) noexcept : re(real), im(imag) {}
+    explicit constexpr SimpleComplex(const std::complex<RealT>& z) noexcept : re(z.real()), im(z.imag()) {}
+
+    [[nodiscard]] constexpr RealT real() const noexcept
+    {
+        return re;
+    }
+
+    [[nodiscard]] constexpr RealT imag() const noexcept
+    {
+        return im;
+    }
+
+    [[nodiscard]] explicit operator std::complex<RealT>() const noexcept
+    {
+        return {re, im};
+    }
+
+    constexpr SimpleComplex& operator+=(const SimpleComplex& other) noexcept
+    {
+        return *this = *this + other;
+    }
+
+    constexpr SimpleComplex& operator-=(const SimpleComplex& other) noexcept
+    {
+        return *this = *this - other;
+    }
+
+    constexpr SimpleComplex& operator*=(const SimpleComplex& other) noexcept
+    {
+        return *this = *this * other;
+    }
+
+    constexpr SimpleComplex& operator/=(const SimpleComplex& other) noexcept
+    {
+        return *this = *this / other;
+    }
+
+    [[nodiscard]] friend constexpr SimpleComplex operator-(const SimpleComplex& z) noexcept
+    {
+        return {-z.re, -z.im};
+    }
+
+    [[nodiscard]] friend constexpr SimpleComplex operator+(const SimpleComplex& z, const SimpleComplex& w) noexcept
+    {
+        return {z.re + w.re, z.im + w.im};
+    }
+
+    [[nodiscard]] friend constexpr SimpleComplex operator-(const SimpleComplex& z, const SimpleComplex& w) noexcept
+    {
+        return {z.re - w.re, z.im - w.im};
+    }
+
+    [[nodiscard]] friend constexpr SimpleComplex operator*(const SimpleComplex& z, const SimpleComplex& w) noexcept
+    {
+        return {z.re * w.re - z.im * w.im, z.re * w.im + z.im * w.re};
+    }
+
+    [[nodiscard]] friend constexpr SimpleComplex operator/(const SimpleComplex& z, const SimpleComplex& w) noexcept
+    {
+        const auto denominator = w.re * w.re + w.im * w.im;
+        return {(z.re * w.re + z.im * w.im) / denominator, (z.im * w.re - z.re * w.im) / denominator};
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const SimpleComplex& z, const SimpleComplex& w) noexcept
+    {
+        return z.re == w.re && z.im == w.im;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const SimpleComplex& z, const SimpleComplex& w) noexcept
+    {
+        return !(z == w);
+    }
+
+    [[nodiscard]] friend constexpr SimpleComplex conj(const SimpleComplex& z) noexcept
+    {
+        return {z.re, -z.im};
+    }
+
+    [[nodiscard]] friend constexpr RealT norm(const SimpleComplex& z) noexcept
+    {
+        return z.re * z.re + z.im * z.im;
+    }
+
+    [[nodiscard]] friend RealT abs(const SimpleComplex& z) noexcept
+    {
+        using std::sqrt;
+        return sqrt(norm(z));
+    }
+};
+
+/// roots stored as separate real and imaginary arrays; root j is `real[j] + i * imag[j]`
+template <typename Real, std::size_t N>
+struct SplitRoots
+{
+    std::array<Real, N> real;
+    std::array<Real, N> imag;
+};
+
+} // namespace dm::math
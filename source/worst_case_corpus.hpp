@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dm::math {
+
+// Quartics on which the solver is slowest, least accurate or not finite, as found by the worst-case explorer
+// (tools/worst_case_explorer.cpp) and replayed by the regression tests and benchmarks. A corpus file holds one entry
+// per line, `kind score c0 c1 c2 c3 c4`, with the coefficients (lowest degree first) as hexadecimal floats and the
+// score with 17 significant digits so that both round-trip exactly; blank lines and lines starting with `#` are
+// ignored.
+
+enum class Outlier
+{
+    /// slowest solves; the score is the time per solve in cycles (or nanoseconds where there is no cycle counter)
+    latency,
+    /// largest `quartic_backward_error`
+    residual,
+    /// roots that are NaN or infinite for finite coefficients; the score is 0
+    nonfinite,
+    /// largest `quartic_backward_error` within the solver's known inaccurate region (see `known_inaccurate`), kept
+    /// apart so that the known failure neither crowds new ones out of `residual` nor hides their regressions
+    known_residual,
+};
+
+struct CorpusEntry
+{
+    Outlier kind;
+    double score;
+    std::array<double, 5> coefficients;
+};
+
+[[nodiscard]] inline const char* to_string(const Outlier kind) noexcept
+{
+    switch (kind) {
+    case Outlier::latency:
+        return "latency";
+    case Outlier::residual:
+        return "residual";
+    case Outlier::nonfinite:
+        return "nonfinite";
+    case Outlier::known_residual:
+        return "known_residual";
+    }
+    return "";
+}
+
+/// Whether `c` lies in the region the explorer searches: 1e-20 <= |c[k] / c[4]| <= 1e6 or c[k] = 0, and
+/// 1e-30 <= |c[4]| <= 1e30. There neither the roots nor the solver's intermediate powers of the coefficients overflow
+/// or go subnormal, so a non-finite root is a solver bug rather than a limit of double.
+[[nodiscard]] inline bool in_search_domain(const std::array<double, 5>& c) noexcept
+{
+    const auto leading = std::abs(c[4]);
+    if (!(leading >= 1e-30 && leading <= 1e30)) {
+        return false;
+    }
+    for (std::size_t k = 0; k < 4; ++k) {
+        const auto ratio = std::abs(c[k]) / leading;
+        if (c[k] != 0 && !(ratio >= 1e-20 && ratio <= 1e6)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Whether `c` is in the region where the solver is known to be inaccurate: |c[3]| >= 1e4 |c[4]|, as in
+/// x^4 - 1e6 x^3 + 1e4 x^2, puts one root near -c[3] / c[4] and the others cancel in the depressed quartic, keeping few
+/// or none of their digits.
+[[nodiscard]] inline bool known_inaccurate(const std::array<double, 5>& c) noexcept
+{
+    return std::abs(c[3]) >= 1e4 * std::abs(c[4]);
+}
+
+/// Normwise backward error of `roots` as the roots of `c`: the largest coefficient difference between `c` and
+/// c[4] * (x - roots[0]) * ... * (x - roots[3]), relative to the largest |c[k]|. Expanded in long double, so it is
+/// the solver's error rather than the check's; infinite if a root is not finite.
+[[nodiscard]] inline double
+quartic_backward_error(const std::array<double, 5>& c, const std::array<std::complex<double>, 4>& roots) noexcept
+{
+    std::array<std::complex<long double>, 5> expanded{1.0L, 0.0L, 0.0L, 0.0L, 0.0L};
+    for (std::size_t j = 0; j < 4; ++j) {
+        if (!std::isfinite(roots[j].real()) || !std::isfinite(roots[j].imag())) {
+            return std::numeric_limits<double>::infinity();
+        }
+        const std::complex<long double> root{roots[j].real(), roots[j].imag()};
+        for (std::size_t k = j + 1; k > 0; --k) {
+            expanded[k] = expanded[k - 1] - root * expanded[k];
+        }
+        expanded[0] *= -root;
+    }
+    long double scale = 0;
+    long double error = 0;
+    for (std::size_t k = 0; k < 5; ++k) {
+        scale = std::max(scale, std::abs(static_cast<long double>(c[k])));
+        const auto difference = static_cast<long double>(c[4]) * expanded[k] - static_cast<long double>(c[k]);
+        error = std::max(error, std::abs(difference));
+    }
+    return static_cast<double>(error / scale);
+}
+
+/// throws `std::runtime_error` naming the line of the first malformed entry
+[[nodiscard]] inline std::vector<CorpusEntry> read_corpus(std::istream& in)
+{
+    std::vector<CorpusEntry> entries;
+    std::string line;
+    for (std::size_t line_number = 1; std::getline(in, line); ++line_number) {
+        std::istringstream fields{line};
+        std::string kind;
+        if (!(fields >> kind) || kind.front() == '#') {
+            continue;
+        }
+        CorpusEntry entry{};
+        if (kind == "latency") {
+            entry.kind = Outlier::latency;
+        } else if (kind == "residual") {
+            entry.kind = Outlier::residual;
+        } else if (kind == "nonfinite") {
+            entry.kind = Outlier::nonfinite;
+        } else if (kind == "known_residual") {
+            entry.kind = Outlier::known_residual;
+        } else {
+            throw std::runtime_error("corpus line " + std::to_string(line_number) + ": unknown kind '" + kind + "'");
+        }
+        // strtod rather than operator>>, which does not parse hexadecimal floats
+        std::array<double*, 6> values{
+            &entry.score,
+            &entry.coefficients[0],
+            &entry.coefficients[1],
+            &entry.coefficients[2],
+            &entry.coefficients[3],
+            &entry.coefficients[4],
+        };
+        for (auto* value : values) {
+            std::string token;
+            char* end = nullptr;
+            if (fields >> token) {
+                *value = std::strtod(token.c_str(), &end);
+            }
+            if (end == nullptr || *end != '\0') {
+                throw std::runtime_error("corpus line " + std::to_string(line_number) + ": expected 6 numbers");
+            }
+        }
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+inline void write_corpus(std::ostream& out, const std::vector<CorpusEntry>& entries)
+{
+    for (const auto& entry : entries) {
+        char buffer[256];
+        const auto& c = entry.coefficients;
+        std::snprintf(
+            buffer, sizeof(buffer), "%s %.17g %a %a %a %a %a\n", to_string(entry.kind), entry.score, c[0], c[1], c[2],
+            c[3], c[4]
+        );
+        out << buffer;
+    }
+}
+
+} // namespace dm::math
@@ -0,0 +1,192 @@
+#include "batch_roots.hpp"
+#include "test_polynomials.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace dm::math;
+using dm::math::test::quartic_from_real_roots;
+
+namespace {
+
+const std::vector<std::array<double, 5>> batch_coefficients{
+    quartic_from_real_roots(1, 2, 3, 4),
+    quartic_from_real_roots(-4, -3, 2, 5),
+    {1, 0, 0, 0, 1}, // x^4 + 1
+    {6, -5, 1, 0, 0}, // x^2 - 5x + 6
+};
+
+} // namespace
+
+TEST(BatchQuartic, RealRootCounts)
+{
+    std::array<std::uint8_t, 4> counts{};
+    batch::quartic_real_root_counts<double>(batch_coefficients, counts.data());
+
+    EXPECT_EQ(counts[0], 4);
+    EXPECT_EQ(counts[1], 4);
+    EXPECT_EQ(counts[2], 0);
+    EXPECT_EQ(counts[3], 2);
+}
+
+TEST(BatchQuartic, MinMaxRealRoots)
+{
+    std::array<float, 4> min_roots{};
+    std::array<float, 4> max_roots{};
+    std::array<double, 4> min_positive_roots{};
+    batch::quartic_min_real_roots<double>(batch_coefficients, min_roots.data());
+    batch::quartic_max_real_roots<double>(batch_coefficients, max_roots.data());
+    batch::quartic_min_positive_real_roots<double>(batch_coefficients, min_positive_roots.data());
+
+    const auto epsilon = 1e-5;
+    EXPECT_NEAR(min_roots[0], 1, epsilon);
+    EXPECT_NEAR(max_roots[0], 4, epsilon);
+    EXPECT_NEAR(min_roots[1], -4, epsilon);
+    EXPECT_NEAR(max_roots[1], 5, epsilon);
+    EXPECT_TRUE(std::isnan(min_roots[2]));
+    EXPECT_TRUE(std::isnan(max_roots[2]));
+    EXPECT_NEAR(min_roots[3], 2, epsilon);
+    EXPECT_NEAR(max_roots[3], 3, epsilon);
+
+    EXPECT_NEAR(min_positive_roots[0], 1, epsilon);
+    EXPECT_NEAR(min_positive_roots[1], 2, epsilon);
+    EXPECT_TRUE(std::isnan(min_positive_roots[2]));
+    EXPECT_NEAR(min_positive_roots[3], 2, epsilon);
+}
+
+TEST(BatchQuartic, MinMaxRealRootsMatchAllRoots)
+{
+    // random quartics, some with a vanishing leading coefficient, and ones with double roots near the threshold
+    std::mt19937_64 generator{11};
+    std::normal_distribution<double> coefficient;
+    std::vector<std::array<double, 5>> quartics(2000);
+    for (std::size_t i = 0; i < quartics.size(); ++i) {
+        for (auto& c : quartics[i]) {
+            c = coefficient(generator);
+        }
+        if (i % 10 == 0) {
+            quartics[i][4] = 0;
+        }
+    }
+    quartics.push_back(quartic_from_real_roots(1, 1, -2, -2));
+    quartics.push_back({1 + 1e-9, -2, 1, 0, 0});
+
+    const auto n = quartics.size();
+    std::vector<double> min_roots(n);
+    std::vector<double> max_roots(n);
+    std::vector<double> min_positive_roots(n);
+    batch::quartic_min_real_roots<double>(quartics, min_roots.data());
+    batch::quartic_max_real_roots<double>(quartics, max_roots.data());
+    batch::quartic_min_positive_real_roots<double>(quartics, min_positive_roots.data());
+
+    const auto same = [](const double a, const double b) { return a == b || (std::isnan(a) && std::isnan(b)); };
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto [roots, n_roots] = quartic_real_roots<double>(quartics[i]);
+        const auto none = std::numeric_limits<double>::quiet_NaN();
+        auto min_root = none;
+        auto max_root = none;
+        auto min_positive_root = none;
+        for (std::size_t j = 0; j < n_roots; ++j) {
+            min_root = (std::isnan(min_root) || roots[j] < min_root) ? roots[j] : min_root;
+            max_root = (std::isnan(max_root) || roots[j] > max_root) ? roots[j] : max_root;
+            if (roots[j] > 0 && (std::isnan(min_positive_root) || roots[j] < min_positive_root)) {
+                min_positive_root = roots[j];
+            }
+        }
+        EXPECT_TRUE(same(min_roots[i], min_root)) << "polynomial " << i;
+        EXPECT_TRUE(same(max_roots[i], max_root)) << "polynomial " << i;
+        EXPECT_TRUE(same(min_positive_roots[i], min_positive_root)) << "polynomial " << i;
+    }
+}
+
+TEST(BatchQuartic, SortedRealRoots)
+{
+    std::array<std::array<double, 4>, 4> roots{};
+    std::array<std::size_t, 4> counts{};
+    batch::quartic_real_roots_sorted<double>(
+        batch_coefficients, std::array{roots[0].data(), roots[1].data(), roots[2].data(), roots[3].data()}, counts.data()
+    );
+
+    ASSERT_EQ(counts[1], 4);
+    const auto epsilon = 1e-9;
+    EXPECT_NEAR(roots[0][1], -4, epsilon);
+    EXPECT_NEAR(roots[1][1], -3, epsilon);
+    EXPECT_NEAR(roots[2][1], 2, epsilon);
+    EXPECT_NEAR(roots[3][1], 5, epsilon);
+}
+
+TEST(BatchQuartic, SplitComplexRoots)
+{
+    const std::vector<std::array<double, 5>> coefficients{{1, 0, 0, 0, 1}};
+    std::array<double, 4> real{};
+    std::array<double, 4> imag{};
+    batch::quartic_roots<double>(
+        coefficients, std::array{&real[0], &real[1], &real[2], &real[3]}, std::array{&imag[0], &imag[1], &imag[2], &imag[3]}
+    );
+
+    const auto component = std::sqrt(0.5);
+    const auto epsilon = 1e-9;
+    for (std::size_t j = 0; j < 4; ++j) {
+        EXPECT_NEAR(std::abs(real[j]), component, epsilon);
+        EXPECT_NEAR(std::abs(imag[j]), component, epsilon);
+    }
+}
+
+TEST(BatchQuartic, RealRootsByDegreeMatchesScalarFallback)
+{
+    const std::vector<std::array<double, 5>> coefficients{
+        quartic_from_real_roots(1, 2, 3, 4),
+        {-6, 11, -6, 1, 0}, // (x - 1)(x - 2)(x - 3)
+        {6, -5, 1, 0, 0},   // (x - 2)(x - 3)
+        {3, 2, 0, 0, 0},    // 2x + 3
+        {5, 0, 0, 0, 0},
+        {1, 0, 1, 0, 0}, // x^2 + 1
+        quartic_from_real_roots(-4, -3, 2, 5),
+    };
+    std::array<std::vector<double>, 4> roots;
+    for (auto& root : roots) {
+        root.assign(coefficients.size(), 0);
+    }
+    std::vector<std::size_t> counts(coefficients.size());
+
+    batch::quartic_real_roots_by_degree<double>(
+        coefficients, std::array{roots[0].data(), roots[1].data(), roots[2].data(), roots[3].data()}, counts.data()
+    );
+
+    for (std::size_t i = 0; i < coefficients.size(); ++i) {
+        const auto [expected, n_expected] = quartic_real_roots<double>(coefficients[i]);
+        ASSERT_EQ(counts[i], n_expected) << i;
+        for (std::size_t j = 0; j < n_expected; ++j) {
+            EXPECT_EQ(roots[j][i], expected[j]) << i << ", " << j;
+        }
+    }
+    EXPECT_EQ(counts[3], 1);
+    EXPECT_EQ(roots[0][3], -1.5);
+}
+
+TEST(BatchQuartic, RealRootsByDegreeTolerance)
+{
+    // (x - 1)(x - 2)(x - 3) with a leading coefficient of rounding-noise size
+    const std::vector<std::array<double, 5>> coefficients{{-6, 11, -6, 1, 1e-17}};
+    std::array<double, 4> roots{};
+    std::array<std::uint8_t, 1> counts{};
+    batch::DegreeBuckets<double> buckets;
+
+    batch::quartic_real_roots_by_degree<double>(
+        coefficients, std::array{&roots[0], &roots[1], &roots[2], &roots[3]}, counts.data(), buckets, 1e-12
+    );
+
+    EXPECT_EQ(buckets.size(3), 1);
+    ASSERT_EQ(counts[0], 3);
+    std::sort(roots.begin(), roots.begin() + 3);
+    for (std::size_t j = 0; j < 3; ++j) {
+        EXPECT_NEAR(roots[j], static_cast<double>(j + 1), 1e-9);
+    }
+}
@@ -0,0 +1,84 @@
+#include "bernstein_roots.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+using namespace dm::math;
+
+namespace {
+
+/// Bernstein coefficients of (t - r0)(t - r1)(t - r2), from the blossom: b[i] is the symmetric average of products
+std::array<double, 4> cubic_bernstein_from_roots(double r0, double r1, double r2)
+{
+    const auto blossom = [&](double u0, double u1, double u2) {
+        // average over the assignments of the arguments to the factors
+        return ((u0 - r0) * (u1 - r1) * (u2 - r2) + (u0 - r0) * (u2 - r1) * (u1 - r2) + (u1 - r0) * (u0 - r1) * (u2 - r2) +
+                (u1 - r0) * (u2 - r1) * (u0 - r2) + (u2 - r0) * (u0 - r1) * (u1 - r2) + (u2 - r0) * (u1 - r1) * (u0 - r2)) /
+               6;
+    };
+    return {blossom(0, 0, 0), blossom(0, 0, 1), blossom(0, 1, 1), blossom(1, 1, 1)};
+}
+
+} // namespace
+
+TEST(BernsteinCubic, RootsOnUnitInterval)
+{
+    const auto [roots, n_roots] = cubic_bernstein_roots(cubic_bernstein_from_roots(0.25, 0.5, 3.0));
+
+    ASSERT_EQ(n_roots, 2);
+    EXPECT_NEAR(roots[0], 0.25, 1e-12);
+    EXPECT_NEAR(roots[1], 0.5, 1e-12);
+}
+
+TEST(BernsteinCubic, EndPointRoots)
+{
+    const auto [roots, n_roots] = cubic_bernstein_roots(cubic_bernstein_from_roots(0.0, 1.0, -2.0));
+
+    ASSERT_EQ(n_roots, 2);
+    EXPECT_NEAR(roots[0], 0.0, 1e-12);
+    EXPECT_NEAR(roots[1], 1.0, 1e-12);
+}
+
+TEST(BernsteinCubic, ControlPolygonRejection)
+{
+    const std::array<double, 4> b{1.0, 0.5, 2.0, 0.25};
+    EXPECT_TRUE(internal::bernstein_root_free(b));
+    EXPECT_EQ(cubic_bernstein_roots(b).second, 0);
+}
+
+TEST(BernsteinQuartic, PowerBasisConversion)
+{
+    // t^4 has Bernstein coefficients (0, 0, 0, 0, 1)
+    const auto a = internal::bernstein_to_power(std::array<double, 5>{0, 0, 0, 0, 1});
+    EXPECT_EQ(a, (std::array<double, 5>{0, 0, 0, 0, 1}));
+
+    // the constant 1 has all Bernstein coefficients 1
+    const auto one = internal::bernstein_to_power(std::array<double, 5>{1, 1, 1, 1, 1});
+    EXPECT_EQ(one, (std::array<double, 5>{1, 0, 0, 0, 0}));
+}
+
+TEST(BernsteinBatch, CubicSegments)
+{
+    const auto crossing = cubic_bernstein_from_roots(0.25, 0.5, 3.0);
+    const std::array<double, 4> positive{1.0, 0.5, 2.0, 0.25};
+    const std::array<double, 2> b0{crossing[0], positive[0]};
+    const std::array<double, 2> b1{crossing[1], positive[1]};
+    const std::array<double, 2> b2{crossing[2], positive[2]};
+    const std::array<double, 2> b3{crossing[3], positive[3]};
+
+    std::array<std::array<float, 2>, 3> roots{};
+    std::array<std::uint8_t, 2> counts{};
+    batch::cubic_bernstein_roots<double>(
+        std::array{b0.data(), b1.data(), b2.data(), b3.data()},
+        2,
+        std::array{roots[0].data(), roots[1].data(), roots[2].data()},
+        counts.data()
+    );
+
+    ASSERT_EQ(counts[0], 2);
+    EXPECT_NEAR(roots[0][0], 0.25, 1e-6);
+    EXPECT_NEAR(roots[1][0], 0.5, 1e-6);
+    EXPECT_EQ(counts[1], 0);
+}
@@ -0,0 +1,243 @@
+#include "polynomial_roots.h"
+#include "quartic_roots.hpp"
+#include "worst_case_corpus.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// (x - 1)(x - 2)(x - 3)(x - 4) and x^4 + 1
+constexpr std::array<std::array<double, 5>, 2> quartics{{{24, -50, 35, -10, 1}, {1, 0, 0, 0, 1}}};
+
+/// Rows of five coefficients for the kernel comparison: random coefficients of mixed magnitudes with some zeros, and
+/// products of two quadratics whose discriminants are close to zero on either side, for near-double roots and complex
+/// pairs near the real axis; followed by the worst-case corpus.
+std::vector<double> comparison_rows(const std::size_t n_random)
+{
+    std::mt19937_64 generator{34};
+    std::uniform_real_distribution<double> uniform{0, 1};
+    const auto log_uniform = [&](const double low, const double high) {
+        return std::pow(10.0, low + (high - low) * uniform(generator));
+    };
+    const auto sign = [&] { return (uniform(generator) < 0.5) ? -1.0 : 1.0; };
+
+    std::vector<double> rows;
+    for (std::size_t i = 0; i < n_random; ++i) {
+        std::array<double, 5> c;
+        if (i % 2 == 0) {
+            for (auto& coefficient : c) {
+                coefficient = (uniform(generator) < 0.15) ? 0.0 : sign() * log_uniform(-3, 3);
+            }
+        } else {
+            const auto p1 = 20 * uniform(generator) - 10;
+            const auto p2 = 20 * uniform(generator) - 10;
+            const auto q1 = p1 * p1 / 4 + sign() * log_uniform(-12, 0);
+            const auto q2 = p2 * p2 / 4 + sign() * log_uniform(-12, 0);
+            const auto scale = sign() * log_uniform(-3, 3);
+            // scale (x^2 + p1 x + q1)(x^2 + p2 x + q2)
+            c = {scale * q1 * q2, scale * (p1 * q2 + p2 * q1), scale * (q1 + q2 + p1 * p2), scale * (p1 + p2), scale};
+        }
+        rows.insert(rows.end(), c.begin(), c.end());
+    }
+
+    std::ifstream in{POLYNOMIAL_ROOTS_WORST_CASE_CORPUS};
+    EXPECT_TRUE(in.is_open()) << POLYNOMIAL_ROOTS_WORST_CASE_CORPUS;
+    for (const auto& entry : dm::math::read_corpus(in)) {
+        rows.insert(rows.end(), entry.coefficients.begin(), entry.coefficients.end());
+    }
+    return rows;
+}
+
+/// everything a kernel wrote, as bytes so that NaNs and signed zeros compare bit for bit
+using KernelOutput = std::vector<unsigned char>;
+
+template <typename T>
+void append_bytes(KernelOutput& bytes, const std::vector<T>& values)
+{
+    const auto* begin = reinterpret_cast<const unsigned char*>(values.data());
+    bytes.insert(bytes.end(), begin, begin + values.size() * sizeof(T));
+}
+
+template <typename Real>
+using ComplexRootsKernel = dm_polyroots_status (*)(std::size_t, const Real*, Real*, Real*, dm_polyroots_layout);
+
+template <typename Real>
+using RealRootsKernel = dm_polyroots_status (*)(std::size_t, const Real*, Real*, std::uint8_t*, dm_polyroots_layout);
+
+/// runs `kernel` of degree `degree` over the highest `degree + 1` coefficients of every row
+template <typename Real>
+KernelOutput run(const ComplexRootsKernel<Real> kernel, const std::size_t degree, const std::vector<Real>& rows)
+{
+    const auto n = rows.size() / 5;
+    std::vector<Real> real(degree * n);
+    std::vector<Real> imag(degree * n);
+    const dm_polyroots_layout layout{5, 1, static_cast<std::ptrdiff_t>(degree), 1};
+    EXPECT_EQ(kernel(n, rows.data() + (4 - degree), real.data(), imag.data(), layout), DM_POLYROOTS_OK);
+    KernelOutput bytes;
+    append_bytes(bytes, real);
+    append_bytes(bytes, imag);
+    return bytes;
+}
+
+template <typename Real>
+KernelOutput run(const RealRootsKernel<Real> kernel, const std::size_t degree, const std::vector<Real>& rows)
+{
+    const auto n = rows.size() / 5;
+    // slots beyond the root count are left untouched and compare as zero
+    std::vector<Real> roots(degree * n);
+    std::vector<std::uint8_t> counts(n);
+    const dm_polyroots_layout layout{5, 1, static_cast<std::ptrdiff_t>(degree), 1};
+    EXPECT_EQ(kernel(n, rows.data() + (4 - degree), roots.data(), counts.data(), layout), DM_POLYROOTS_OK);
+    KernelOutput bytes;
+    append_bytes(bytes, roots);
+    append_bytes(bytes, counts);
+    return bytes;
+}
+
+struct NamedKernel
+{
+    std::string name;
+    std::function<KernelOutput()> run;
+};
+
+/// every dispatched kernel of the C API over `rows` and their float rounding
+std::vector<NamedKernel> dispatched_kernels(const std::vector<double>& rows, const std::vector<float>& float_rows)
+{
+    return {
+        {"quartic_roots_f64", [&] { return run<double>(dm_polyroots_quartic_roots_f64, 4, rows); }},
+        {"quartic_roots_f32", [&] { return run<float>(dm_polyroots_quartic_roots_f32, 4, float_rows); }},
+        {"quartic_real_roots_f64", [&] { return run<double>(dm_polyroots_quartic_real_roots_f64, 4, rows); }},
+        {"quartic_real_roots_f32", [&] { return run<float>(dm_polyroots_quartic_real_roots_f32, 4, float_rows); }},
+        {"cubic_roots_f64", [&] { return run<double>(dm_polyroots_cubic_roots_f64, 3, rows); }},
+        {"cubic_roots_f32", [&] { return run<float>(dm_polyroots_cubic_roots_f32, 3, float_rows); }},
+        {"cubic_real_roots_f64", [&] { return run<double>(dm_polyroots_cubic_real_roots_f64, 3, rows); }},
+        {"cubic_real_roots_f32", [&] { return run<float>(dm_polyroots_cubic_real_roots_f32, 3, float_rows); }},
+        {"quadratic_real_roots_f64", [&] { return run<double>(dm_polyroots_quadratic_real_roots_f64, 2, rows); }},
+        {"quadratic_real_roots_f32",
+         [&] { return run<float>(dm_polyroots_quadratic_real_roots_f32, 2, float_rows); }},
+    };
+}
+
+} // namespace
+
+TEST(CApi, QuarticRootsArrayOfStructs)
+{
+    std::array<double, 8> real{};
+    std::array<double, 8> imag{};
+    const dm_polyroots_layout layout{5, 1, 4, 1};
+
+    ASSERT_EQ(dm_polyroots_quartic_roots_f64(2, quartics[0].data(), real.data(), imag.data(), layout), DM_POLYROOTS_OK);
+
+    for (std::size_t i = 0; i < 2; ++i) {
+        const auto expected = dm::math::quartic_roots<double>(quartics[i]);
+        for (std::size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(real[4 * i + j], expected[j].real());
+            EXPECT_EQ(imag[4 * i + j], expected[j].imag());
+        }
+    }
+}
+
+TEST(CApi, QuarticRealRootsStructureOfArrays)
+{
+    // coefficient k of polynomial i at k * 2 + i, roots written root-major
+    std::array<float, 10> coefficients{};
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t k = 0; k < 5; ++k) {
+            coefficients[k * 2 + i] = static_cast<float>(quartics[i][k]);
+        }
+    }
+    std::array<float, 8> roots{};
+    std::array<std::uint8_t, 2> counts{};
+    const dm_polyroots_layout layout{1, 2, 1, 2};
+
+    ASSERT_EQ(
+        dm_polyroots_quartic_real_roots_f32(2, coefficients.data(), roots.data(), counts.data(), layout),
+        DM_POLYROOTS_OK
+    );
+
+    ASSERT_EQ(counts[0], 4);
+    EXPECT_EQ(counts[1], 0);
+    std::vector<float> first{roots[0], roots[2], roots[4], roots[6]};
+    std::sort(first.begin(), first.end());
+    for (std::size_t j = 0; j < 4; ++j) {
+        EXPECT_NEAR(first[j], static_cast<float>(j + 1), 1e-3);
+    }
+}
+
+TEST(CApi, CubicAndQuadraticRealRoots)
+{
+    const std::array<double, 4> cubic{-6, 11, -6, 1};
+    const std::array<double, 3> quadratic{2, -3, 1};
+    std::array<double, 3> roots{};
+    std::array<std::uint8_t, 1> counts{};
+
+    ASSERT_EQ(
+        dm_polyroots_cubic_real_roots_f64(1, cubic.data(), roots.data(), counts.data(), {4, 1, 3, 1}), DM_POLYROOTS_OK
+    );
+    EXPECT_EQ(counts[0], 3);
+
+    ASSERT_EQ(
+        dm_polyroots_quadratic_real_roots_f64(1, quadratic.data(), roots.data(), counts.data(), {3, 1, 2, 1}),
+        DM_POLYROOTS_OK
+    );
+    EXPECT_EQ(counts[0], 2);
+    EXPECT_DOUBLE_EQ(roots[0] + roots[1], 3);
+}
+
+TEST(CApi, NullPointers)
+{
+    std::array<double, 4> real{};
+    EXPECT_EQ(
+        dm_polyroots_quartic_roots_f64(1, quartics[0].data(), real.data(), nullptr, {5, 1, 4, 1}),
+        DM_POLYROOTS_NULL_POINTER
+    );
+    EXPECT_EQ(dm_polyroots_quartic_roots_f64(0, nullptr, nullptr, nullptr, {5, 1, 4, 1}), DM_POLYROOTS_OK);
+}
+
+TEST(CApi, EveryAvailableIsaMatchesBaseline)
+{
+    const auto detected = dm_polyroots_detected_isa();
+    EXPECT_EQ(dm_polyroots_selected_isa(), detected);
+
+    const auto rows = comparison_rows(4096);
+    std::vector<float> float_rows(rows.size());
+    std::transform(rows.begin(), rows.end(), float_rows.begin(), [](const double c) { return static_cast<float>(c); });
+    const auto kernels = dispatched_kernels(rows, float_rows);
+
+    ASSERT_EQ(dm_polyroots_force_isa(DM_POLYROOTS_ISA_BASELINE), DM_POLYROOTS_OK);
+    std::vector<KernelOutput> baseline;
+    for (const auto& kernel : kernels) {
+        baseline.push_back(kernel.run());
+    }
+
+    for (int isa = DM_POLYROOTS_ISA_BASELINE + 1; isa <= DM_POLYROOTS_ISA_AVX512; ++isa) {
+        const auto name = dm_polyroots_isa_name(static_cast<dm_polyroots_isa>(isa));
+        const auto status = dm_polyroots_force_isa(static_cast<dm_polyroots_isa>(isa));
+        if (isa > detected) {
+            EXPECT_EQ(status, DM_POLYROOTS_UNSUPPORTED_ISA) << name;
+            continue;
+        }
+        ASSERT_EQ(status, DM_POLYROOTS_OK) << name;
+        EXPECT_EQ(dm_polyroots_selected_isa(), isa) << name;
+        for (std::size_t k = 0; k < kernels.size(); ++k) {
+            // EXPECT_TRUE rather than EXPECT_EQ, which would print both buffers in full
+            EXPECT_TRUE(kernels[k].run() == baseline[k]) << kernels[k].name << " differs on " << name;
+        }
+    }
+
+    EXPECT_EQ(dm_polyroots_force_isa(static_cast<dm_polyroots_isa>(42)), DM_POLYROOTS_UNSUPPORTED_ISA);
+    EXPECT_EQ(dm_polyroots_isa_name(static_cast<dm_polyroots_isa>(42)), nullptr);
+    ASSERT_EQ(dm_polyroots_force_isa(detected), DM_POLYROOTS_OK);
+}
@@ -0,0 +1,156 @@
+#include "batch_roots.hpp"
+#include "coefficient_views.hpp"
+#include "test_polynomials.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using namespace dm::math;
+using dm::math::test::make_quartics;
+
+namespace {
+
+struct Particle
+{
+    float mass;
+    double position[3];
+    double coefficients[5];
+    char tag;
+};
+
+/// minimal rank-2 mdspan stand-in with a strided mapping and `operator()` element access
+struct StridedMatrix
+{
+    using value_type = double;
+
+    const double* data;
+    std::size_t rows;
+    std::size_t row_stride;
+    std::size_t column_stride;
+    std::size_t columns = 5;
+
+    [[nodiscard]] std::size_t extent(const std::size_t dimension) const noexcept
+    {
+        return (dimension == 0) ? rows : columns;
+    }
+
+    [[nodiscard]] double operator()(const std::size_t i, const std::size_t k) const noexcept
+    {
+        return data[i * row_stride + k * column_stride];
+    }
+};
+
+/// stand-in with a static extent for the coefficient dimension, like `std::mdspan<double, std::extents<size_t, n, 4>>`
+struct FourColumnMatrix
+{
+    using value_type = double;
+
+    [[nodiscard]] static constexpr std::size_t static_extent(const std::size_t dimension) noexcept
+    {
+        return (dimension == 0) ? std::numeric_limits<std::size_t>::max() : 4;
+    }
+};
+
+static_assert(batch::internal::static_column_extent<FourColumnMatrix> == 4);
+static_assert(batch::internal::static_column_extent<StridedMatrix> == std::numeric_limits<std::size_t>::max());
+
+template <typename Batch>
+void expect_rows(const Batch& rows, const std::vector<std::array<double, 5>>& expected)
+{
+    ASSERT_EQ(std::size(rows), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(rows[i], expected[i]);
+    }
+}
+
+} // namespace
+
+TEST(CoefficientViews, StructMembers)
+{
+    const auto quartics = make_quartics();
+    std::vector<Particle> particles(quartics.size());
+    for (std::size_t i = 0; i < quartics.size(); ++i) {
+        for (std::size_t k = 0; k < 5; ++k) {
+            particles[i].coefficients[k] = quartics[i][k];
+        }
+    }
+    const auto rows = batch::member_rows(particles.data(), particles.size(), &Particle::coefficients);
+    expect_rows(rows, quartics);
+    EXPECT_EQ(std::size(batch::member_rows(static_cast<const Particle*>(nullptr), 0, &Particle::coefficients)), 0u);
+
+    // the scalar solvers take a row directly
+    for (std::size_t i = 0; i < quartics.size(); ++i) {
+        EXPECT_EQ(quartic_roots<double>(rows[i]), quartic_roots<double>(quartics[i]));
+    }
+}
+
+TEST(CoefficientViews, MatricesAndColumns)
+{
+    const auto quartics = make_quartics();
+    const auto n = quartics.size();
+    constexpr std::size_t padded = 7;
+    std::vector<double> row_major(n * padded, -1.0);
+    std::vector<double> column_major(padded * 5, -1.0);
+    std::vector<double> columns(5 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t k = 0; k < 5; ++k) {
+            row_major[i * padded + k] = quartics[i][k];
+            column_major[i + k * padded] = quartics[i][k];
+            columns[k * n + i] = quartics[i][k];
+        }
+    }
+
+    expect_rows(batch::row_major_rows<5>(row_major.data(), n, padded), quartics);
+    expect_rows(batch::column_major_rows<5>(column_major.data(), n, padded), quartics);
+    expect_rows(
+        batch::SoARows<double, 5>{
+            {columns.data(), columns.data() + n, columns.data() + 2 * n, columns.data() + 3 * n, columns.data() + 4 * n},
+            n,
+        },
+        quartics
+    );
+    expect_rows(batch::mdspan_rows<5>(StridedMatrix{column_major.data(), n, 1, padded}), quartics);
+    EXPECT_DEBUG_DEATH(
+        static_cast<void>(batch::mdspan_rows<5>(StridedMatrix{column_major.data(), n, 1, padded, 4})),
+        "one column per coefficient"
+    );
+
+    // a negative polynomial stride walks the rows backwards
+    const batch::StridedRows<double, 5> reversed{
+        row_major.data() + (n - 1) * padded, n, -static_cast<std::ptrdiff_t>(padded * sizeof(double))
+    };
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(reversed[i], quartics[n - 1 - i]);
+    }
+}
+
+TEST(CoefficientViews, BatchSolversReadViewsInPlace)
+{
+    const auto quartics = make_quartics();
+    const auto n = quartics.size();
+    std::vector<float> column_major(5 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t k = 0; k < 5; ++k) {
+            column_major[i + k * n] = static_cast<float>(quartics[i][k]);
+        }
+    }
+    const auto rows = batch::column_major_rows<5>(column_major.data(), n, n);
+
+    std::vector<float> real(4 * n);
+    std::vector<float> imag(4 * n);
+    batch::quartic_roots<float>(
+        rows, std::array<float*, 4>{real.data(), real.data() + n, real.data() + 2 * n, real.data() + 3 * n},
+        std::array<float*, 4>{imag.data(), imag.data() + n, imag.data() + 2 * n, imag.data() + 3 * n}
+    );
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto expected = quartic_roots<float>(rows[i]);
+        for (std::size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(real[j * n + i], expected[j].real());
+            EXPECT_EQ(imag[j * n + i], expected[j].imag());
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#include "batch_roots.hpp"
+#include "compact_coefficients.hpp"
+#include "test_polynomials.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace dm::math;
+using dm::math::test::quartic_from_real_roots;
+
+namespace {
+
+/// quartics with four real roots, two of them sliding apart
+std::vector<std::array<double, 5>> shifted_quartics()
+{
+    std::vector<std::array<double, 5>> quartics;
+    for (int i = 0; i < 64; ++i) {
+        const auto shift = i / 16.0;
+        quartics.push_back(quartic_from_real_roots(-2 - shift, -0.5, 1 + shift, 3.25));
+    }
+    return quartics;
+}
+
+} // namespace
+
+TEST(Half, ExactValuesAndSpecials)
+{
+    EXPECT_EQ(Half::from_float(1.0f).bits, 0x3c00);
+    EXPECT_EQ(Half::from_float(-2.0f).bits, 0xc000);
+    EXPECT_EQ(Half::from_float(65504.0f).bits, 0x7bff);
+    EXPECT_EQ(Half::from_float(65520.0f).bits, 0x7c00); // ties to even overflows
+    EXPECT_EQ(Half::from_float(std::ldexp(1.0f, -14)).bits, 0x0400);
+    EXPECT_EQ(Half::from_float(std::ldexp(1.0f, -24)).bits, 0x0001);
+    EXPECT_EQ(Half::from_float(std::ldexp(1.0f, -25)).bits, 0x0000); // ties to even underflows
+    EXPECT_EQ(Half::from_float(-0.0f).bits, 0x8000);
+    EXPECT_EQ(Half::from_float(std::numeric_limits<float>::infinity()).bits, 0x7c00);
+    EXPECT_TRUE(std::isnan(Half::from_float(std::numeric_limits<float>::quiet_NaN()).to_float()));
+}
+
+TEST(Half, RoundTripsEveryFiniteValue)
+{
+    for (std::uint32_t bits = 0; bits < 0x10000; ++bits) {
+        const Half half{static_cast<std::uint16_t>(bits)};
+        if ((bits & 0x7c00) == 0x7c00) {
+            continue;
+        }
+        ASSERT_EQ(Half::from_float(half.to_float()).bits, bits);
+    }
+}
+
+TEST(Half, RoundsToNearestEven)
+{
+    // 1 + 2^-11 lies halfway between 1 and the next half 1 + 2^-10
+    EXPECT_EQ(Half::from_float(1.0f + std::ldexp(1.0f, -11)).bits, 0x3c00);
+    EXPECT_EQ(Half::from_float(1.0f + 3 * std::ldexp(1.0f, -11)).bits, 0x3c02);
+    EXPECT_EQ(Half::from_float(1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20)).bits, 0x3c01);
+}
+
+TEST(BFloat16, RoundsToNearestEven)
+{
+    EXPECT_EQ(BFloat16::from_float(1.0f).bits, 0x3f80);
+    EXPECT_EQ(BFloat16::from_float(1.0f + std::ldexp(1.0f, -8)).bits, 0x3f80);
+    EXPECT_EQ(BFloat16::from_float(1.0f + 3 * std::ldexp(1.0f, -8)).bits, 0x3f82);
+    EXPECT_EQ(BFloat16::from_float(std::numeric_limits<float>::max()).bits, 0x7f80);
+    EXPECT_TRUE(std::isnan(BFloat16::from_float(std::numeric_limits<float>::quiet_NaN()).to_float()));
+}
+
+TEST(BlockScaled, QuantizesToFullMantissaWidth)
+{
+    const std::array<double, 5> c{24, -50, 35, -10, 1};
+    const auto quantized = quantize_block_scaled<std::int16_t>(c.data(), 1, 5);
+    // 50 < 2^6, so the exponent leaves 15 bits for the largest mantissa
+    ASSERT_EQ(quantized.exponents.size(), 1u);
+    EXPECT_EQ(quantized.exponents[0], 6 - 15);
+    const batch::BlockScaledRows<double, 5, std::int16_t> rows{quantized};
+    for (std::size_t k = 0; k < 5; ++k) {
+        EXPECT_EQ(rows[0][k], c[k]);
+    }
+}
+
+TEST(BlockScaled, SharesExponentsAcrossBlocks)
+{
+    const auto quartics = shifted_quartics();
+    const auto quantized = quantize_block_scaled<std::int32_t>(quartics[0].data(), quartics.size(), 5, 16);
+    EXPECT_EQ(quantized.exponents.size(), 4u);
+    EXPECT_EQ(quantized.size(), quartics.size());
+}
+
+TEST(BlockScaled, RejectsNonFiniteCoefficients)
+{
+    for (const auto bad : {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity()}) {
+        const std::array<double, 5> c{24, -50, bad, -10, 1};
+        EXPECT_THROW((void)quantize_block_scaled<std::int32_t>(c.data(), 1, 5), std::invalid_argument);
+    }
+}
+
+TEST(CompactBatch, SolvesFromWidenedCoefficients)
+{
+    const auto quartics = shifted_quartics();
+    const auto half = encode<Half>(quartics[0].data(), 5 * quartics.size());
+    const batch::CompactRows<float, 5, Half> rows{half.data(), quartics.size()};
+
+    std::vector<float> min_roots(quartics.size());
+    batch::quartic_min_real_roots<float>(rows, min_roots.data());
+
+    for (std::size_t i = 0; i < quartics.size(); ++i) {
+        std::array<float, 5> widened;
+        for (std::size_t k = 0; k < 5; ++k) {
+            widened[k] = half[5 * i + k].to_float();
+        }
+        // rounding can merge close real roots into a complex pair, so compare with the same widened coefficients
+        const auto [roots, n_roots] = quartic_real_roots<float>(widened);
+        ASSERT_GT(n_roots, 0u);
+        EXPECT_EQ(min_roots[i], *std::min_element(roots.begin(), roots.begin() + n_roots));
+    }
+}
+
+TEST(CompactBatch, AccuracyReport)
+{
+    const auto quartics = shifted_quartics();
+    const auto n = quartics.size();
+
+    const auto int32 = quantize_block_scaled<std::int32_t>(quartics[0].data(), n, 5);
+    const auto int32_report =
+        test::quartic_quantization_report<double>(quartics, batch::BlockScaledRows<double, 5, std::int32_t>{int32});
+    EXPECT_EQ(int32_report.n_polynomials, n);
+    EXPECT_LT(int32_report.max_coefficient_error, 1e-9);
+    EXPECT_LT(int32_report.max_root_error, 1e-6);
+
+    const auto half = encode<Half>(quartics[0].data(), 5 * n);
+    const auto half_report =
+        test::quartic_quantization_report<float>(quartics, batch::CompactRows<float, 5, Half>{half.data(), n});
+    EXPECT_LT(half_report.max_coefficient_error, 1e-3);
+    EXPECT_GT(half_report.max_root_error, int32_report.max_root_error);
+    EXPECT_LT(half_report.max_root_error, 0.1);
+    EXPECT_EQ(half_report.n_nonfinite, 0u);
+}
+
+TEST(CompactBatch, AccuracyReportSkipsZeroPolynomials)
+{
+    auto quartics = shifted_quartics();
+    quartics[3] = {};
+    const auto int32 = quantize_block_scaled<std::int32_t>(quartics[0].data(), quartics.size(), 5);
+    const auto report =
+        test::quartic_quantization_report<double>(quartics, batch::BlockScaledRows<double, 5, std::int32_t>{int32});
+    EXPECT_LT(report.max_coefficient_error, 1e-9);
+    EXPECT_LT(report.max_root_error, 1e-6);
+}
@@ -0,0 +1,160 @@
+#include "complex_coefficient_roots.hpp"
+#include "quartic_roots.hpp"
+#include "test_polynomials.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace dm::math;
+using Complex = std::complex<double>;
+using dm::math::test::root_error;
+
+namespace {
+
+/// leading * (z - roots[0]) * ... * (z - roots[N - 1]), lowest degree first
+template <std::size_t N>
+std::array<Complex, N + 1> from_roots(const std::array<Complex, N>& roots, const Complex leading)
+{
+    std::array<Complex, N + 1> c{};
+    c[0] = 1;
+    for (std::size_t j = 0; j < N; ++j) {
+        for (std::size_t k = j + 1; k > 0; --k) {
+            c[k] = c[k - 1] - roots[j] * c[k];
+        }
+        c[0] *= -roots[j];
+    }
+    for (auto& coefficient : c) {
+        coefficient *= leading;
+    }
+    return c;
+}
+
+template <std::size_t N>
+std::vector<std::array<Complex, N>> random_roots(const std::size_t n)
+{
+    std::mt19937_64 generator{7};
+    std::uniform_real_distribution<double> part{-3, 3};
+    std::vector<std::array<Complex, N>> roots(n);
+    for (auto& polynomial_roots : roots) {
+        for (auto& root : polynomial_roots) {
+            root = {part(generator), part(generator)};
+        }
+    }
+    return roots;
+}
+
+} // namespace
+
+TEST(ComplexCoefficients, QuadraticRoots)
+{
+    for (const auto& roots : random_roots<2>(200)) {
+        const auto c = from_roots(roots, Complex{0.5, -2});
+        EXPECT_LT(root_error(roots, complex_quadratic_roots<double>(c)), 1e-12);
+    }
+    EXPECT_EQ(complex_quadratic_roots<double>(std::array<Complex, 3>{0, 0, 3})[1], Complex{});
+}
+
+TEST(ComplexCoefficients, CubicRoots)
+{
+    for (const auto& roots : random_roots<3>(200)) {
+        const auto c = from_roots(roots, Complex{-1, 1});
+        EXPECT_LT(root_error(roots, complex_cubic_roots<double>(c)), 1e-10);
+    }
+    // triple root
+    const std::array<Complex, 3> triple{Complex{1, 2}, Complex{1, 2}, Complex{1, 2}};
+    EXPECT_LT(root_error(triple, complex_cubic_roots<double>(from_roots(triple, 1.0))), 1e-5);
+}
+
+TEST(ComplexCoefficients, QuarticRoots)
+{
+    for (const auto& roots : random_roots<4>(200)) {
+        const auto c = from_roots(roots, Complex{2, 0.25});
+        EXPECT_LT(root_error(roots, complex_quartic_roots<double>(c)), 1e-9);
+    }
+    // q = 0 takes the biquadratic path: z^4 - 1 and z^4 + (1 + i) z^2
+    const std::array<Complex, 4> unity{Complex{1, 0}, Complex{-1, 0}, Complex{0, 1}, Complex{0, -1}};
+    EXPECT_LT(root_error(unity, complex_quartic_roots<double>(std::array<Complex, 5>{-1, 0, 0, 0, 1})), 1e-15);
+    const auto s = std::sqrt(Complex{-1, -1});
+    const std::array<Complex, 4> biquadratic{Complex{}, Complex{}, s, -s};
+    EXPECT_LT(
+        root_error(biquadratic, complex_quartic_roots<double>(std::array<Complex, 5>{0, 0, Complex{1, 1}, 0, 1})),
+        1e-12
+    );
+    const std::array<Complex, 4> zero{};
+    EXPECT_EQ(root_error(zero, complex_quartic_roots<double>(std::array<Complex, 5>{0, 0, 0, 0, 1})), 0);
+}
+
+TEST(ComplexCoefficients, RealCoefficientsMatchRealSolver)
+{
+    const std::vector<std::array<double, 5>> quartics{
+        {24.0, -50.0, 35.0, -10.0, 1.0},
+        {4.0, 0.0, 5.0, 0.0, 1.0},
+        {-6.0, 2.0, 1.0, 2.0, 1.0},
+        {1.0, 2.0, 3.0, 4.0, 5.0},
+    };
+    for (const auto& c : quartics) {
+        const auto expected = quartic_roots<double>(c);
+        EXPECT_LT(root_error(expected, complex_quartic_roots<double>(c)), 1e-9);
+    }
+}
+
+TEST(ComplexCoefficients, BatchForms)
+{
+    const auto all_roots = random_roots<4>(64);
+    std::vector<std::array<Complex, 5>> quartics;
+    for (const auto& roots : all_roots) {
+        quartics.push_back(from_roots(roots, Complex{1, -1}));
+    }
+    const auto n = quartics.size();
+    std::vector<float> real(4 * n);
+    std::vector<float> imag(4 * n);
+    batch::complex_quartic_roots<double>(
+        quartics, std::array<float*, 4>{real.data(), real.data() + n, real.data() + 2 * n, real.data() + 3 * n},
+        std::array<float*, 4>{imag.data(), imag.data() + n, imag.data() + 2 * n, imag.data() + 3 * n}
+    );
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto expected = complex_quartic_roots<double>(quartics[i]);
+        for (std::size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(real[j * n + i], static_cast<float>(expected[j].real()));
+            EXPECT_EQ(imag[j * n + i], static_cast<float>(expected[j].imag()));
+        }
+    }
+
+    std::vector<std::array<std::complex<float>, 4>> cubics;
+    for (const auto& c : quartics) {
+        cubics.push_back({std::complex<float>(c[1]), std::complex<float>(c[2]), std::complex<float>(c[3]),
+                          std::complex<float>(c[4])});
+    }
+    batch::complex_cubic_roots<float>(
+        cubics, std::array<float*, 3>{real.data(), real.data() + n, real.data() + 2 * n},
+        std::array<float*, 3>{imag.data(), imag.data() + n, imag.data() + 2 * n}
+    );
+    std::vector<std::array<Complex, 3>> quadratics;
+    for (const auto& c : quartics) {
+        quadratics.push_back({c[2], c[3], c[4]});
+    }
+    std::vector<double> real2(2 * n);
+    std::vector<double> imag2(2 * n);
+    batch::complex_quadratic_roots<double>(
+        quadratics, std::array<double*, 2>{real2.data(), real2.data() + n},
+        std::array<double*, 2>{imag2.data(), imag2.data() + n}
+    );
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto cubic = complex_cubic_roots<float>(cubics[i]);
+        const auto quadratic = complex_quadratic_roots<double>(quadratics[i]);
+        for (std::size_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(real[j * n + i], cubic[j].real());
+            EXPECT_EQ(imag[j * n + i], cubic[j].imag());
+        }
+        for (std::size_t j = 0; j < 2; ++j) {
+            EXPECT_EQ(real2[j * n + i], quadratic[j].real());
+            EXPECT_EQ(imag2[j * n + i], quadratic[j].imag());
+        }
+    }
+}
@@ -0,0 +1,241 @@
+#include "conic_intersection.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+template <typename Real>
+bool contains_point(const ConicIntersection<Real>& result, Real x, Real y, Real epsilon)
+{
+    for (std::size_t i = 0; i < result.n_points; ++i) {
+        if (std::abs(result.x[i] - x) < epsilon && std::abs(result.y[i] - y) < epsilon) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// compares `batch::intersect` on pairs `first[i]`, `second[i]` with the scalar `intersect` of each pair
+template <typename Shape, typename Arrays>
+void expect_batch_matches_scalar(
+    const std::vector<Shape>& first,
+    const std::vector<Shape>& second,
+    const Arrays& first_arrays,
+    const Arrays& second_arrays
+)
+{
+    const auto n = first.size();
+    std::array<std::vector<double>, 4> x;
+    std::array<std::vector<double>, 4> y;
+    for (std::size_t j = 0; j < 4; ++j) {
+        x[j].resize(n);
+        y[j].resize(n);
+    }
+    std::vector<std::uint8_t> counts(n);
+    batch::intersect<double>(
+        first_arrays,
+        second_arrays,
+        std::array{x[0].data(), x[1].data(), x[2].data(), x[3].data()},
+        std::array{y[0].data(), y[1].data(), y[2].data(), y[3].data()},
+        counts.data()
+    );
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto expected = intersect(first[i], second[i]);
+        ASSERT_EQ(counts[i], expected.n_points) << "pair " << i;
+        for (std::size_t j = 0; j < expected.n_points; ++j) {
+            EXPECT_NEAR(x[j][i], expected.x[j], 1e-9) << "pair " << i;
+            EXPECT_NEAR(y[j][i], expected.y[j], 1e-9) << "pair " << i;
+        }
+    }
+}
+
+} // namespace
+
+TEST(ConicIntersection, CirclesMirroredAcrossCommonAxis)
+{
+    // x^2 + y^2 = 4 and (x - 2)^2 + y^2 = 4 meet at (1, +-sqrt(3))
+    const Conic<double> p{1, 0, 1, 0, 0, -4};
+    const Conic<double> q{1, 0, 1, -4, 0, 0};
+
+    const auto result = intersect(p, q);
+
+    ASSERT_EQ(result.n_points, 2);
+    EXPECT_TRUE(contains_point(result, 1.0, std::sqrt(3.0), 1e-6));
+    EXPECT_TRUE(contains_point(result, 1.0, -std::sqrt(3.0), 1e-6));
+}
+
+TEST(ConicIntersection, VerticalAxisParabolas)
+{
+    // y = x^2 and y = 2 - x^2 have no y^2 term, so the resultant with respect to y vanishes; they meet at (+-1, 1)
+    const Conic<double> p{1, 0, 0, 0, -1, 0};
+    const Conic<double> q{1, 0, 0, 0, 1, -2};
+
+    const auto result = intersect(p, q);
+
+    ASSERT_EQ(result.n_points, 2);
+    EXPECT_TRUE(contains_point(result, 1.0, 1.0, 1e-6));
+    EXPECT_TRUE(contains_point(result, -1.0, 1.0, 1e-6));
+}
+
+TEST(ConicIntersection, ConicsWithoutSquaredTerms)
+{
+    // x*y = 1 and x*y + x - y = 1, i.e. x = y, meet at (1, 1) and (-1, -1)
+    const Conic<double> p{0, 1, 0, 0, 0, -1};
+    const Conic<double> q{0, 1, 0, 1, -1, -1};
+
+    const auto hyperbolas = intersect(p, q);
+
+    ASSERT_EQ(hyperbolas.n_points, 2);
+    EXPECT_TRUE(contains_point(hyperbolas, 1.0, 1.0, 1e-6));
+    EXPECT_TRUE(contains_point(hyperbolas, -1.0, -1.0, 1e-6));
+
+    // x + y = 3 and x - y = 1
+    const auto lines = intersect(Conic<double>{0, 0, 0, 1, 1, -3}, Conic<double>{0, 0, 0, 1, -1, -1});
+    ASSERT_EQ(lines.n_points, 1);
+    EXPECT_TRUE(contains_point(lines, 2.0, 1.0, 1e-12));
+}
+
+TEST(ConicIntersection, EllipsesFourPoints)
+{
+    // axis-aligned ellipse and the same ellipse rotated a quarter turn meet at (+-k, +-k), k = 2 / sqrt(5)
+    const Ellipse<double> p{3, -1, 2, 1, 0};
+    const Ellipse<double> q{3, -1, 2, 1, M_PI / 2};
+
+    const auto result = intersect(p, q);
+
+    const auto k = 2 / std::sqrt(5.0);
+    ASSERT_EQ(result.n_points, 4);
+    EXPECT_TRUE(contains_point(result, 3 + k, -1 + k, 1e-6));
+    EXPECT_TRUE(contains_point(result, 3 + k, -1 - k, 1e-6));
+    EXPECT_TRUE(contains_point(result, 3 - k, -1 + k, 1e-6));
+    EXPECT_TRUE(contains_point(result, 3 - k, -1 - k, 1e-6));
+}
+
+TEST(ConicIntersection, SeparatedEllipsesAreRejected)
+{
+    const Ellipse<double> p{0, 0, 2, 1, 0.3};
+    const Ellipse<double> q{10, 0, 2, 1, -0.3};
+
+    EXPECT_TRUE(separated(p, q));
+    EXPECT_EQ(intersect(p, q).n_points, 0);
+}
+
+TEST(ConicIntersection, BatchEllipses)
+{
+    const std::array<double, 2> center_x{0, 0};
+    const std::array<double, 2> center_y{0, 0};
+    const std::array<double, 2> radius_x{2, 2};
+    const std::array<double, 2> radius_y{1, 1};
+    const std::array<double, 2> angle{0, 0};
+    const std::array<double, 2> other_center_x{1, 50};
+    const std::array<double, 2> other_center_y{0, 0};
+    const std::array<double, 2> other_radius_x{2, 2};
+    const std::array<double, 2> other_radius_y{1, 1};
+    const std::array<double, 2> other_angle{0, 0};
+
+    const batch::EllipseArrays<double> first{
+        center_x.data(), center_y.data(), radius_x.data(), radius_y.data(), angle.data(), 2
+    };
+    const batch::EllipseArrays<double> second{
+        other_center_x.data(), other_center_y.data(), other_radius_x.data(), other_radius_y.data(), other_angle.data(), 2
+    };
+
+    std::array<std::array<float, 2>, 4> x{};
+    std::array<std::array<float, 2>, 4> y{};
+    std::array<std::uint8_t, 2> counts{};
+    batch::intersect<double>(
+        first,
+        second,
+        std::array{x[0].data(), x[1].data(), x[2].data(), x[3].data()},
+        std::array{y[0].data(), y[1].data(), y[2].data(), y[3].data()},
+        counts.data()
+    );
+
+    // x^2/4 + y^2 = 1 and (x - 1)^2/4 + y^2 = 1 meet at (1/2, +-sqrt(15)/4)
+    ASSERT_EQ(counts[0], 2);
+    EXPECT_NEAR(x[0][0], 0.5, 1e-5);
+    EXPECT_NEAR(x[1][0], 0.5, 1e-5);
+    EXPECT_NEAR(std::abs(y[0][0]), std::sqrt(15.0) / 4, 1e-5);
+    EXPECT_NEAR(y[0][0], -y[1][0], 1e-5);
+    EXPECT_EQ(counts[1], 0);
+}
+
+TEST(ConicIntersection, SeparatedConics)
+{
+    const Conic<double> unit_circle{1, 0, 1, 0, 0, -1};
+    const Conic<double> far_circle{1, 0, 1, -20, 0, 99};
+    const Conic<double> no_points{1, 0, 1, 0, 0, 1};
+    const Conic<double> parabola{1, 0, 0, 0, -1, 0};
+
+    EXPECT_TRUE(separated(unit_circle, far_circle));
+    EXPECT_FALSE(separated(unit_circle, Conic<double>{1, 0, 1, -3, 0, 1.25}));
+    EXPECT_TRUE(separated(no_points, parabola));
+    EXPECT_FALSE(separated(far_circle, parabola));
+}
+
+TEST(ConicIntersection, BatchMatchesScalar)
+{
+    // enough pairs for several packets, many of them separated
+    constexpr std::size_t n = 300;
+    std::mt19937_64 generator{29};
+    std::uniform_real_distribution<double> centers{-4, 4};
+    std::uniform_real_distribution<double> radii{0.5, 2};
+    std::uniform_real_distribution<double> angles{0, 3.14159};
+    std::uniform_real_distribution<double> coefficients{-1, 1};
+
+    std::array<std::array<std::vector<double>, 5>, 2> ellipse_parameters;
+    std::array<std::vector<Ellipse<double>>, 2> ellipses;
+    std::array<std::array<std::vector<double>, 6>, 2> conic_coefficients;
+    std::array<std::vector<Conic<double>>, 2> conics;
+    for (std::size_t side = 0; side < 2; ++side) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const Ellipse<double> ellipse{
+                centers(generator), centers(generator), radii(generator), radii(generator), angles(generator)
+            };
+            ellipses[side].push_back(ellipse);
+            ellipse_parameters[side][0].push_back(ellipse.center_x);
+            ellipse_parameters[side][1].push_back(ellipse.center_y);
+            ellipse_parameters[side][2].push_back(ellipse.radius_x);
+            ellipse_parameters[side][3].push_back(ellipse.radius_y);
+            ellipse_parameters[side][4].push_back(ellipse.angle);
+
+            Conic<double> conic{};
+            for (auto* coefficient : {&conic.a, &conic.b, &conic.c, &conic.d, &conic.e, &conic.f}) {
+                *coefficient = coefficients(generator);
+            }
+            // every tenth pair without y^2 terms, which the batch hands to the scalar path
+            if (i % 10 == 0) {
+                conic.c = 0;
+            }
+            conics[side].push_back(conic);
+            conic_coefficients[side][0].push_back(conic.a);
+            conic_coefficients[side][1].push_back(conic.b);
+            conic_coefficients[side][2].push_back(conic.c);
+            conic_coefficients[side][3].push_back(conic.d);
+            conic_coefficients[side][4].push_back(conic.e);
+            conic_coefficients[side][5].push_back(conic.f);
+        }
+    }
+
+    const auto ellipse_arrays = [&](const std::size_t side) {
+        const auto& e = ellipse_parameters[side];
+        return batch::EllipseArrays<double>{e[0].data(), e[1].data(), e[2].data(), e[3].data(), e[4].data(), n};
+    };
+    const auto conic_arrays = [&](const std::size_t side) {
+        const auto& c = conic_coefficients[side];
+        return batch::ConicArrays<double>{
+            c[0].data(), c[1].data(), c[2].data(), c[3].data(), c[4].data(), c[5].data(), n
+        };
+    };
+    expect_batch_matches_scalar(ellipses[0], ellipses[1], ellipse_arrays(0), ellipse_arrays(1));
+    expect_batch_matches_scalar(conics[0], conics[1], conic_arrays(0), conic_arrays(1));
+}
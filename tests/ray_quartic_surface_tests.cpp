@@ -0,0 +1,108 @@
+#include "ray_quartic_surfaces.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace dm::math;
+
+TEST(RayTorus, NearestHitThroughTube)
+{
+    const Torus<double> torus{3, 1};
+
+    // along the x axis the ray enters the tube at x = -4, leaves at -2, and enters again at 2
+    EXPECT_NEAR(nearest_hit(torus, Vector3<double>{-10, 0, 0}, Vector3<double>{1, 0, 0}), 6, 1e-9);
+    EXPECT_NEAR(nearest_hit(torus, Vector3<double>{-10, 0, 0}, Vector3<double>{2, 0, 0}), 3, 1e-9);
+    EXPECT_NEAR(nearest_hit(torus, Vector3<double>{-10, 0, 0}, Vector3<double>{1, 0, 0}, 6.5), 8, 1e-9);
+    EXPECT_NEAR(nearest_hit(torus, Vector3<double>{-3, 0, 0}, Vector3<double>{1, 0, 0}), 1, 1e-9);
+}
+
+TEST(RayTorus, Misses)
+{
+    const Torus<double> torus{3, 1};
+    const auto miss = std::numeric_limits<double>::infinity();
+
+    // through the hole, outside the bounding sphere, behind the origin, and beyond t_max
+    EXPECT_EQ(nearest_hit(torus, Vector3<double>{0, 0, 10}, Vector3<double>{0, 0, -1}), miss);
+    EXPECT_EQ(nearest_hit(torus, Vector3<double>{-10, 5, 0}, Vector3<double>{1, 0, 0}), miss);
+    EXPECT_EQ(nearest_hit(torus, Vector3<double>{-10, 0, 0}, Vector3<double>{-1, 0, 0}), miss);
+    EXPECT_EQ(nearest_hit(torus, Vector3<double>{-10, 0, 0}, Vector3<double>{1, 0, 0}, 0.0, 5.0), miss);
+}
+
+TEST(RayTorus, Packet)
+{
+    const Torus<float> torus{3, 1};
+    const std::array<float, 3> origin_x{-10, 0, 0};
+    const std::array<float, 3> origin_y{0, -10, 0};
+    const std::array<float, 3> origin_z{0, 0, 10};
+    const std::array<float, 3> direction_x{1, 0, 0};
+    const std::array<float, 3> direction_y{0, 1, 0};
+    const std::array<float, 3> direction_z{0, 0, -1};
+    const batch::RayPacket<float> rays{
+        origin_x.data(),
+        origin_y.data(),
+        origin_z.data(),
+        direction_x.data(),
+        direction_y.data(),
+        direction_z.data(),
+        3,
+    };
+
+    std::array<float, 3> t{};
+    batch::nearest_hits(torus, rays, t.data());
+
+    EXPECT_NEAR(t[0], 6, 1e-4);
+    EXPECT_NEAR(t[1], 6, 1e-4);
+    EXPECT_EQ(t[2], std::numeric_limits<float>::infinity());
+}
+
+TEST(RayTorus, PacketMatchesPerRay)
+{
+    // a fan of rays across the torus, through its hole and past it, more than one packet's worth
+    const Torus<double> torus{3, 1};
+    std::vector<double> origin_x;
+    std::vector<double> origin_y;
+    std::vector<double> origin_z;
+    std::vector<double> direction_x;
+    std::vector<double> direction_y;
+    std::vector<double> direction_z;
+    for (int i = 0; i < 150; ++i) {
+        origin_x.push_back(-10);
+        origin_y.push_back(0.5);
+        origin_z.push_back(2);
+        direction_x.push_back(1);
+        direction_y.push_back(-0.5 + i / 150.0);
+        direction_z.push_back(-0.2);
+    }
+    const batch::RayPacket<double> rays{
+        origin_x.data(),
+        origin_y.data(),
+        origin_z.data(),
+        direction_x.data(),
+        direction_y.data(),
+        direction_z.data(),
+        origin_x.size(),
+    };
+
+    for (const auto t_max : {std::numeric_limits<double>::infinity(), 9.0}) {
+        std::vector<double> t(rays.n);
+        batch::nearest_hits(torus, rays, t.data(), 0.0, t_max);
+        std::size_t n_hits = 0;
+        for (std::size_t i = 0; i < rays.n; ++i) {
+            const auto expected = nearest_hit(
+                torus,
+                Vector3<double>{origin_x[i], origin_y[i], origin_z[i]},
+                Vector3<double>{direction_x[i], direction_y[i], direction_z[i]},
+                0.0,
+                t_max
+            );
+            EXPECT_EQ(t[i], expected) << "ray " << i;
+            n_hits += !std::isinf(t[i]);
+        }
+        EXPECT_GT(n_hits, 0);
+        EXPECT_LT(n_hits, rays.n);
+    }
+}
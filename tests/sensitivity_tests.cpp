@@ -0,0 +1,104 @@
+#include "dual.hpp"
+#include "quartic_roots.hpp"
+#include "root_sensitivities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <limits>
+
+using namespace dm::math;
+
+TEST(Sensitivities, QuadraticMatchesFiniteDifferences)
+{
+    const std::array<double, 3> c{2, -3, 1};
+    const auto result = quadratic_real_roots_with_jacobian(c);
+    ASSERT_EQ(result.n_roots, 2);
+
+    const auto h = 1e-7;
+    for (std::size_t k = 0; k < 3; ++k) {
+        auto perturbed = c;
+        perturbed[k] += h;
+        const auto [roots, n_roots] = quadratic_real_roots(perturbed);
+        ASSERT_EQ(n_roots, 2);
+        for (std::size_t j = 0; j < 2; ++j) {
+            EXPECT_NEAR(result.jacobian[j][k], (roots[j] - result.roots[j]) / h, 1e-5) << "root " << j << " c" << k;
+        }
+    }
+}
+
+TEST(Sensitivities, CubicComplexRootsMatchFiniteDifferences)
+{
+    // (x - 2)(x^2 + 2x + 5), roots 2 and -1 +- 2i
+    const std::array<double, 4> c{-10, 1, 0, 1};
+    const auto result = cubic_roots_with_jacobian(c);
+
+    const auto h = 1e-7;
+    for (std::size_t k = 0; k < 4; ++k) {
+        auto perturbed = c;
+        perturbed[k] += h;
+        const auto roots = cubic_roots<double>(perturbed);
+        for (std::size_t j = 0; j < 3; ++j) {
+            const auto difference = (roots[j] - result.roots[j]) / h;
+            EXPECT_NEAR(result.jacobian[j][k].real(), difference.real(), 1e-5) << "root " << j << " c" << k;
+            EXPECT_NEAR(result.jacobian[j][k].imag(), difference.imag(), 1e-5) << "root " << j << " c" << k;
+        }
+    }
+}
+
+TEST(Sensitivities, QuarticJacobianMatchesDualNumbers)
+{
+    // (x - 1)(x - 2)(x + 3)(x - 5)
+    const std::array<double, 5> c{30, -29, -7, 5, 1};
+    const auto result = quartic_roots_with_jacobian(c);
+
+    for (std::size_t k = 0; k < 5; ++k) {
+        std::array<Dual<double>, 5> seeded{c[0], c[1], c[2], c[3], c[4]};
+        seeded[k] = Dual<double>{c[k], 1};
+        const auto [roots, n_roots] = quartic_real_roots<Dual<double>>(seeded);
+        ASSERT_EQ(n_roots, 4);
+        for (std::size_t j = 0; j < 4; ++j) {
+            EXPECT_NEAR(roots[j].value(), result.roots[j].real(), 1e-9);
+            EXPECT_NEAR(roots[j].derivative(), result.jacobian[j][k].real(), 1e-7) << "root " << j << " c" << k;
+            EXPECT_EQ(result.jacobian[j][k].imag(), 0);
+        }
+    }
+}
+
+TEST(Sensitivities, DualSqrtAtZero)
+{
+    const auto constant = sqrt(Dual<double>{0, 0});
+    EXPECT_EQ(constant.value(), 0);
+    EXPECT_EQ(constant.derivative(), 0);
+    const auto rising = sqrt(Dual<double>{0, 1});
+    EXPECT_EQ(rising.value(), 0);
+    EXPECT_EQ(rising.derivative(), std::numeric_limits<double>::infinity());
+}
+
+TEST(Sensitivities, BiquadraticJacobianMatchesDualNumbers)
+{
+    // b1 == 0, so a resolvent root is 0 and one factor of the closed form is the square root of 0
+    const std::array<std::array<double, 5>, 3> biquadratics{{
+        {4, 0, -5, 0, 1},  // +-1, +-2
+        {4, 0, 5, 0, 1},   // +-i, +-2i
+        {-2, 0, -1, 0, 1}, // +-sqrt(2), +-i
+    }};
+    for (const auto& c : biquadratics) {
+        const auto result = quartic_roots_with_jacobian(c);
+        for (std::size_t k = 0; k < 5; ++k) {
+            std::array<Dual<double>, 5> seeded{c[0], c[1], c[2], c[3], c[4]};
+            seeded[k] = Dual<double>{c[k], 1};
+            const auto roots = quartic_roots<Dual<double>>(seeded);
+            for (std::size_t j = 0; j < 4; ++j) {
+                EXPECT_NEAR(roots[j].real().value(), result.roots[j].real(), 1e-12);
+                EXPECT_NEAR(roots[j].imag().value(), result.roots[j].imag(), 1e-12);
+                EXPECT_NEAR(roots[j].real().derivative(), result.jacobian[j][k].real(), 1e-9)
+                    << "c2 " << c[2] << " root " << j << " c" << k;
+                EXPECT_NEAR(roots[j].imag().derivative(), result.jacobian[j][k].imag(), 1e-9)
+                    << "c2 " << c[2] << " root " << j << " c" << k;
+            }
+        }
+    }
+}
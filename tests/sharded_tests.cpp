@@ -0,0 +1,202 @@
+#include "quartic_roots.hpp"
+#include "sharded_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+std::vector<double> make_coefficients(std::size_t n)
+{
+    std::vector<double> coefficients;
+    coefficients.reserve(5 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto shift = static_cast<double>(i % 97) / 10;
+        // (x - shift)(x - 1 - shift)(x^2 + 1)
+        const std::array<double, 5> c{
+            shift * (1 + shift), -(1 + 2 * shift), 1 + shift * (1 + shift), -(1 + 2 * shift), 1.0,
+        };
+        coefficients.insert(coefficients.end(), c.begin(), c.end());
+    }
+    return coefficients;
+}
+
+void expect_matches_scalar(const std::vector<double>& coefficients, const sharded::SharedQuarticRoots& roots)
+{
+    for (std::size_t i = 0; i < roots.size(); ++i) {
+        const auto expected = quartic_roots<double>(std::array{
+            coefficients[5 * i],
+            coefficients[5 * i + 1],
+            coefficients[5 * i + 2],
+            coefficients[5 * i + 3],
+            coefficients[5 * i + 4],
+        });
+        for (std::size_t j = 0; j < 4; ++j) {
+            ASSERT_EQ(roots.real(j)[i], expected[j].real()) << "polynomial " << i << " root " << j;
+            ASSERT_EQ(roots.imag(j)[i], expected[j].imag()) << "polynomial " << i << " root " << j;
+        }
+    }
+}
+
+/// true once `pid` has exited, whether or not its new parent has reaped it yet
+bool exited(const pid_t pid)
+{
+    if (kill(pid, 0) < 0 && errno == ESRCH) {
+        return true;
+    }
+    std::ifstream stat{"/proc/" + std::to_string(pid) + "/stat"};
+    std::string field;
+    // pid, (comm), state
+    return stat >> field >> field >> field && field == "Z";
+}
+
+} // namespace
+
+TEST(ShardedQuartic, MatchesScalarSolver)
+{
+    const std::size_t n = 10'000;
+    const auto coefficients = make_coefficients(n);
+    const sharded::SharedQuarticRoots roots{n};
+
+    sharded::ShardOptions options;
+    options.n_workers = 3;
+    options.shard_size = 512;
+    const auto report = sharded::solve_quartics(coefficients.data(), n, roots, options);
+
+    EXPECT_EQ(report.n_shards, 20);
+    EXPECT_EQ(report.n_workers_spawned, 3);
+    EXPECT_EQ(report.n_worker_failures, 0);
+    EXPECT_EQ(report.n_shards_solved_by_coordinator, 0);
+    expect_matches_scalar(coefficients, roots);
+}
+
+TEST(ShardedQuartic, RestartsFailedShards)
+{
+    const std::size_t n = 4'000;
+    const auto coefficients = make_coefficients(n);
+    const sharded::SharedQuarticRoots roots{n};
+
+    const sharded::SharedMapping crashed{sizeof(std::atomic<bool>)};
+    auto& crashed_once = *new (crashed.data()) std::atomic<bool>{false};
+
+    sharded::ShardOptions options;
+    options.n_workers = 2;
+    options.shard_size = 100;
+    options.before_shard = [&crashed_once](std::size_t shard) {
+        if (shard == 7 && !crashed_once.exchange(true)) {
+            _exit(1);
+        }
+    };
+    const auto report = sharded::solve_quartics(coefficients.data(), n, roots, options);
+
+    EXPECT_EQ(report.n_worker_failures, 1);
+    EXPECT_EQ(report.n_workers_spawned, 3);
+    EXPECT_EQ(report.n_shards_solved_by_coordinator, 0);
+    expect_matches_scalar(coefficients, roots);
+}
+
+TEST(ShardedQuartic, ThrowingShardCountsAsWorkerFailure)
+{
+    const std::size_t n = 2'000;
+    const auto coefficients = make_coefficients(n);
+    const sharded::SharedQuarticRoots roots{n};
+
+    const sharded::SharedMapping thrown{sizeof(std::atomic<bool>)};
+    auto& thrown_once = *new (thrown.data()) std::atomic<bool>{false};
+
+    sharded::ShardOptions options;
+    options.n_workers = 2;
+    options.shard_size = 100;
+    options.before_shard = [&thrown_once](std::size_t shard) {
+        if (shard == 0 && !thrown_once.exchange(true)) {
+            throw std::runtime_error("boom");
+        }
+    };
+    // only the coordinator may return from here; an exception escaping a worker would unwind into this test
+    const auto coordinator = getpid();
+    const auto report = sharded::solve_quartics(coefficients.data(), n, roots, options);
+    ASSERT_EQ(getpid(), coordinator);
+
+    EXPECT_EQ(report.n_worker_failures, 1);
+    EXPECT_EQ(report.n_workers_spawned, 3);
+    expect_matches_scalar(coefficients, roots);
+}
+
+TEST(ShardedQuartic, LeavesOtherChildrenAlone)
+{
+    const auto other = fork();
+    ASSERT_GE(other, 0);
+    if (other == 0) {
+        _exit(42);
+    }
+
+    const std::size_t n = 1'000;
+    const auto coefficients = make_coefficients(n);
+    const sharded::SharedQuarticRoots roots{n};
+    sharded::ShardOptions options;
+    options.n_workers = 2;
+    options.shard_size = 100;
+    sharded::solve_quartics(coefficients.data(), n, roots, options);
+
+    int status = 0;
+    ASSERT_EQ(waitpid(other, &status, 0), other);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 42);
+}
+
+TEST(ShardedQuartic, WorkersDieWithCoordinator)
+{
+    const sharded::SharedMapping published{sizeof(std::atomic<pid_t>)};
+    auto& worker = *new (published.data()) std::atomic<pid_t>{0};
+
+    const auto coordinator = fork();
+    ASSERT_GE(coordinator, 0);
+    if (coordinator == 0) {
+        const std::size_t n = 1'000;
+        const auto coefficients = make_coefficients(n);
+        const sharded::SharedQuarticRoots roots{n};
+        sharded::ShardOptions options;
+        options.n_workers = 1;
+        options.shard_size = 100;
+        options.before_shard = [&worker](std::size_t shard) {
+            if (shard == 0) {
+                worker.store(getpid());
+                std::this_thread::sleep_for(std::chrono::seconds(2));
+            }
+        };
+        sharded::solve_quartics(coefficients.data(), n, roots, options);
+        _exit(0);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (worker.load() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const auto worker_pid = worker.load();
+    kill(coordinator, SIGKILL);
+    ASSERT_EQ(waitpid(coordinator, nullptr, 0), coordinator);
+    ASSERT_NE(worker_pid, 0);
+
+    // well before the worker would wake up and finish its shards
+    const auto kill_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (!exited(worker_pid) && std::chrono::steady_clock::now() < kill_deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(exited(worker_pid));
+}
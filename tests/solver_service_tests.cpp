@@ -0,0 +1,299 @@
+#include "quartic_roots.hpp"
+#include "solver_service.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+std::string test_socket_path(const char* name)
+{
+    return "/tmp/polynomial_roots_" + std::string{name} + "." + std::to_string(getpid()) + ".sock";
+}
+
+/// runs a server on a background thread for the lifetime of the fixture object
+class RunningServer
+{
+  public:
+    explicit RunningServer(service::ServerOptions options) : server_(std::move(options)), thread_([this] { server_.run(); })
+    {}
+
+    ~RunningServer()
+    {
+        stop();
+    }
+
+    service::ServerStats stop()
+    {
+        if (thread_.joinable()) {
+            server_.stop();
+            thread_.join();
+        }
+        return server_.stats();
+    }
+
+  private:
+    service::Server server_;
+    std::thread thread_;
+};
+
+std::vector<double> make_coefficients(const std::size_t n, const std::size_t seed)
+{
+    std::vector<double> coefficients;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto shift = static_cast<double>((seed + i) % 13) / 3;
+        // (x - shift)(x + 1)(x^2 + shift)
+        const std::array<double, 5> c{-shift * shift, shift * (1 - shift), 0.0, 1 - shift, 1.0};
+        coefficients.insert(coefficients.end(), c.begin(), c.end());
+    }
+    return coefficients;
+}
+
+/// raw stream socket connected to `path`, for clients that do not follow `service::Client`'s request-reply pattern
+int connect_raw(const std::string& path)
+{
+    const auto fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    if (fd >= 0 && connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+std::vector<unsigned char> make_request(const std::size_t n)
+{
+    const service::MessageHeader header{service::request_magic, static_cast<std::uint32_t>(n)};
+    const auto coefficients = make_coefficients(n, 0);
+    std::vector<unsigned char> request(sizeof(header) + coefficients.size() * sizeof(double));
+    std::memcpy(request.data(), &header, sizeof(header));
+    std::memcpy(request.data() + sizeof(header), coefficients.data(), coefficients.size() * sizeof(double));
+    return request;
+}
+
+/// reads until the server closes the connection
+std::vector<unsigned char> receive_to_end(const int fd)
+{
+    std::vector<unsigned char> received;
+    std::array<unsigned char, 1 << 16> buffer;
+    for (auto n_read = recv(fd, buffer.data(), buffer.size(), 0); n_read != 0;
+         n_read = recv(fd, buffer.data(), buffer.size(), 0)) {
+        if (n_read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        received.insert(received.end(), buffer.begin(), buffer.begin() + n_read);
+    }
+    return received;
+}
+
+} // namespace
+
+TEST(SolverService, CoalescesConcurrentClients)
+{
+    service::ServerOptions options;
+    options.socket_path = test_socket_path("coalesce");
+    options.latency_budget = std::chrono::milliseconds{20};
+    RunningServer server{options};
+
+    constexpr std::size_t n_clients = 8;
+    constexpr std::size_t n_requests = 3;
+    std::vector<std::thread> clients;
+    std::vector<int> n_mismatches(n_clients, 0);
+    for (std::size_t k = 0; k < n_clients; ++k) {
+        clients.emplace_back([&, k] {
+            service::Client client{options.socket_path};
+            for (std::size_t r = 0; r < n_requests; ++r) {
+                const auto n = 1 + k + r;
+                const auto coefficients = make_coefficients(n, k * n_requests + r);
+                std::vector<double> real(4 * n);
+                std::vector<double> imag(4 * n);
+                client.solve_quartics(coefficients.data(), n, real.data(), imag.data());
+                for (std::size_t i = 0; i < n; ++i) {
+                    const auto expected = quartic_roots<double>(std::array{
+                        coefficients[5 * i],
+                        coefficients[5 * i + 1],
+                        coefficients[5 * i + 2],
+                        coefficients[5 * i + 3],
+                        coefficients[5 * i + 4],
+                    });
+                    for (std::size_t j = 0; j < 4; ++j) {
+                        n_mismatches[k] += real[4 * i + j] != expected[j].real() || imag[4 * i + j] != expected[j].imag();
+                    }
+                }
+            }
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    const auto stats = server.stop();
+
+    for (std::size_t k = 0; k < n_clients; ++k) {
+        EXPECT_EQ(n_mismatches[k], 0) << "client " << k;
+    }
+    EXPECT_EQ(stats.n_connections, n_clients);
+    EXPECT_EQ(stats.n_requests, n_clients * n_requests);
+    EXPECT_LT(stats.n_batches, stats.n_requests);
+}
+
+TEST(SolverService, RejectsOversizedRequests)
+{
+    service::ServerOptions options;
+    options.socket_path = test_socket_path("oversized");
+    options.max_request = 4;
+    RunningServer server{options};
+
+    service::Client client{options.socket_path};
+    const auto coefficients = make_coefficients(5, 0);
+    std::vector<double> real(20);
+    std::vector<double> imag(20);
+    EXPECT_THROW(client.solve_quartics(coefficients.data(), 5, real.data(), imag.data()), std::system_error);
+}
+
+TEST(SolverService, RefusesSocketOfLiveServer)
+{
+    service::ServerOptions options;
+    options.socket_path = test_socket_path("live");
+    RunningServer server{options};
+
+    try {
+        service::Server second{options};
+        FAIL() << "second server bound a live socket";
+    } catch (const std::system_error& error) {
+        EXPECT_EQ(error.code().value(), EADDRINUSE);
+    }
+}
+
+TEST(SolverService, AnswersClientsThatShutDownSending)
+{
+    service::ServerOptions options;
+    options.socket_path = test_socket_path("half_closed");
+    options.latency_budget = std::chrono::milliseconds{20};
+    RunningServer server{options};
+
+    const auto fd = connect_raw(options.socket_path);
+    ASSERT_GE(fd, 0);
+    const auto request = make_request(3);
+    ASSERT_EQ(send(fd, request.data(), request.size(), 0), static_cast<ssize_t>(request.size()));
+    ASSERT_EQ(send(fd, request.data(), request.size(), 0), static_cast<ssize_t>(request.size()));
+    shutdown(fd, SHUT_WR);
+
+    const auto received = receive_to_end(fd);
+    close(fd);
+    const auto reply_bytes = sizeof(service::MessageHeader) + 8 * 3 * sizeof(double);
+    ASSERT_EQ(received.size(), 2 * reply_bytes);
+    service::MessageHeader header;
+    std::memcpy(&header, received.data() + reply_bytes, sizeof(header));
+    EXPECT_EQ(header.magic, service::response_magic);
+    EXPECT_EQ(header.n, 3);
+    EXPECT_EQ(server.stop().n_requests, 2);
+}
+
+TEST(SolverService, StopsReadingClientsThatDoNotReadReplies)
+{
+    service::ServerOptions options;
+    options.socket_path = test_socket_path("backpressure");
+    options.latency_budget = std::chrono::microseconds{0};
+    options.max_output = 4096;
+    RunningServer server{options};
+
+    const auto fd = connect_raw(options.socket_path);
+    ASSERT_GE(fd, 0);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    // pipeline requests without reading any reply until the socket stops accepting them
+    constexpr std::size_t n = 16;
+    const auto request = make_request(n);
+    constexpr std::size_t max_requests = std::size_t{1} << 16;
+    std::size_t n_bytes_sent = 0;
+    while (n_bytes_sent < max_requests * request.size()) {
+        const auto offset = n_bytes_sent % request.size();
+        const auto n_written = send(fd, request.data() + offset, request.size() - offset, MSG_NOSIGNAL);
+        if (n_written < 0) {
+            ASSERT_TRUE(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) << std::strerror(errno);
+            if (errno == EINTR) {
+                continue;
+            }
+            pollfd writable{fd, POLLOUT, 0};
+            if (poll(&writable, 1, 300) == 0) {
+                break;
+            }
+            continue;
+        }
+        n_bytes_sent += static_cast<std::size_t>(n_written);
+    }
+    ASSERT_LT(n_bytes_sent, max_requests * request.size()) << "the server kept reading requests";
+
+    // complete the last request, then every reply arrives once the client reads
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+    std::thread sender{[&] {
+        const auto offset = n_bytes_sent % request.size();
+        if (offset != 0) {
+            send(fd, request.data() + offset, request.size() - offset, MSG_NOSIGNAL);
+        }
+        shutdown(fd, SHUT_WR);
+    }};
+    const auto received = receive_to_end(fd);
+    sender.join();
+    close(fd);
+
+    const auto n_requests = (n_bytes_sent + request.size() - 1) / request.size();
+    EXPECT_EQ(received.size(), n_requests * (sizeof(service::MessageHeader) + 8 * n * sizeof(double)));
+    EXPECT_EQ(server.stop().n_requests, n_requests);
+}
+
+TEST(SolverService, DropsUnreadRequestsOfClientsThatHangUp)
+{
+    service::ServerOptions options;
+    options.socket_path = test_socket_path("hangup");
+    options.latency_budget = std::chrono::microseconds{0};
+    options.max_output = 4096;
+    RunningServer server{options};
+
+    const auto fd = connect_raw(options.socket_path);
+    ASSERT_GE(fd, 0);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    // fill the socket buffers past the point where the server stops reading, then hang up without reading replies
+    constexpr std::size_t n = 16;
+    const auto request = make_request(n);
+    std::size_t n_bytes_sent = 0;
+    while (true) {
+        const auto offset = n_bytes_sent % request.size();
+        const auto n_written = send(fd, request.data() + offset, request.size() - offset, MSG_NOSIGNAL);
+        if (n_written >= 0) {
+            n_bytes_sent += static_cast<std::size_t>(n_written);
+            continue;
+        }
+        ASSERT_TRUE(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) << std::strerror(errno);
+        pollfd writable{fd, POLLOUT, 0};
+        if (errno != EINTR && poll(&writable, 1, 300) == 0) {
+            break;
+        }
+    }
+    close(fd);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // the requests still in the socket buffers were never read
+    EXPECT_LT(server.stop().n_requests, n_bytes_sent / request.size());
+}
@@ -0,0 +1,159 @@
+#include "batch_roots.hpp"
+#include "split_complex.hpp"
+#include "test_polynomials.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+using namespace dm::math;
+using dm::math::test::make_quartics;
+
+TEST(SplitComplex, ArithmeticMatchesStdComplex)
+{
+    const std::complex<double> a{1.5, -2.0};
+    const std::complex<double> b{-0.25, 3.0};
+    const SimpleComplex<double> sa{a};
+    const SimpleComplex<double> sb{b};
+
+    const auto check = [](const SimpleComplex<double>& actual, const std::complex<double>& expected) {
+        EXPECT_DOUBLE_EQ(actual.real(), expected.real());
+        EXPECT_DOUBLE_EQ(actual.imag(), expected.imag());
+    };
+    check(sa + sb, a + b);
+    check(sa - sb, a - b);
+    check(sa * sb, a * b);
+    check(sa / sb, a / b);
+    check(-sa, -a);
+    check(conj(sa), std::conj(a));
+    EXPECT_DOUBLE_EQ(norm(sa), std::norm(a));
+    EXPECT_DOUBLE_EQ(abs(sa), std::abs(a));
+
+    auto sc = sa;
+    sc *= sb;
+    sc += sa;
+    EXPECT_EQ(sc, sa * sb + sa);
+    EXPECT_EQ(static_cast<std::complex<double>>(sa), a);
+}
+
+TEST(SplitComplex, ExplicitCoefficientsStillSelectStdComplex)
+{
+    for (const auto& c : make_quartics()) {
+        const auto expected = quartic_roots<double>(c);
+        const auto roots = quartic_roots<double, std::array<double, 5>>(c);
+        const auto monic = monic_quartic_roots<double, std::array<double, 5>>(c);
+        const auto monic_expected = monic_quartic_roots<double>(c);
+        for (std::size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(roots[j], expected[j]);
+            EXPECT_EQ(monic[j], monic_expected[j]);
+        }
+
+        const std::array<double, 4> cubic{c[1], c[2], c[3], c[4]};
+        const auto cubic_roots_explicit = cubic_roots<double, std::array<double, 4>>(cubic);
+        const auto monic_cubic = monic_cubic_roots<double, std::array<double, 4>>(cubic);
+        const auto cubic_expected = cubic_roots<double>(cubic);
+        const auto monic_cubic_expected = monic_cubic_roots<double>(cubic);
+        for (std::size_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(cubic_roots_explicit[j], cubic_expected[j]);
+            EXPECT_EQ(monic_cubic[j], monic_cubic_expected[j]);
+        }
+    }
+}
+
+TEST(SplitComplex, SolversHonorComplexParameter)
+{
+    for (const auto& c : make_quartics()) {
+        const auto expected = quartic_roots<double>(c);
+        const auto roots = quartic_roots<double, SimpleComplex>(c);
+        for (std::size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(roots[j].real(), expected[j].real());
+            EXPECT_EQ(roots[j].imag(), expected[j].imag());
+        }
+
+        const std::array<double, 4> cubic{c[1], c[2], c[3], c[4]};
+        const auto cubic_expected = cubic_roots<double>(cubic);
+        const auto cubic_simple = cubic_roots<double, SimpleComplex>(cubic);
+        for (std::size_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(cubic_simple[j].real(), cubic_expected[j].real());
+            EXPECT_EQ(cubic_simple[j].imag(), cubic_expected[j].imag());
+        }
+
+        const std::array<double, 3> quadratic{c[2], c[3], c[4]};
+        const auto quadratic_expected = quadratic_roots<double>(quadratic);
+        const auto quadratic_simple = quadratic_roots<double, SimpleComplex>(quadratic);
+        for (std::size_t j = 0; j < 2; ++j) {
+            EXPECT_EQ(quadratic_simple[j].real(), quadratic_expected[j].real());
+            EXPECT_EQ(quadratic_simple[j].imag(), quadratic_expected[j].imag());
+        }
+    }
+}
+
+TEST(SplitComplex, SplitRootsMatchArrays)
+{
+    for (const auto& c : make_quartics()) {
+        const auto expected = quartic_roots<double>(c);
+        const auto split = quartic_roots_split<double>(c);
+        for (std::size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(split.real[j], expected[j].real());
+            EXPECT_EQ(split.imag[j], expected[j].imag());
+        }
+
+        const std::array<double, 4> cubic{c[1], c[2], c[3], c[4]};
+        const auto cubic_expected = cubic_roots<double>(cubic);
+        const auto cubic_split = cubic_roots_split<double>(cubic);
+        for (std::size_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(cubic_split.real[j], cubic_expected[j].real());
+            EXPECT_EQ(cubic_split.imag[j], cubic_expected[j].imag());
+        }
+
+        const std::array<double, 3> quadratic{c[2], c[3], c[4]};
+        const auto quadratic_expected = quadratic_roots<double>(quadratic);
+        const auto quadratic_split = quadratic_roots_split<double>(quadratic);
+        for (std::size_t j = 0; j < 2; ++j) {
+            EXPECT_EQ(quadratic_split.real[j], quadratic_expected[j].real());
+            EXPECT_EQ(quadratic_split.imag[j], quadratic_expected[j].imag());
+        }
+    }
+}
+
+TEST(SplitComplex, BatchCubicAndQuadraticRoots)
+{
+    std::vector<std::array<double, 4>> cubics;
+    std::vector<std::array<double, 3>> quadratics;
+    for (const auto& c : make_quartics()) {
+        cubics.push_back({c[1], c[2], c[3], c[4]});
+        quadratics.push_back({c[2], c[3], c[4]});
+    }
+    const auto n = cubics.size();
+
+    std::vector<double> cubic_real(3 * n);
+    std::vector<double> cubic_imag(3 * n);
+    batch::cubic_roots<double>(
+        cubics,
+        std::array<double*, 3>{cubic_real.data(), cubic_real.data() + n, cubic_real.data() + 2 * n},
+        std::array<double*, 3>{cubic_imag.data(), cubic_imag.data() + n, cubic_imag.data() + 2 * n}
+    );
+    std::vector<double> quadratic_real(2 * n);
+    std::vector<double> quadratic_imag(2 * n);
+    batch::quadratic_roots<double>(
+        quadratics,
+        std::array<double*, 2>{quadratic_real.data(), quadratic_real.data() + n},
+        std::array<double*, 2>{quadratic_imag.data(), quadratic_imag.data() + n}
+    );
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto cubic_expected = cubic_roots<double>(cubics[i]);
+        for (std::size_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(cubic_real[j * n + i], cubic_expected[j].real());
+            EXPECT_EQ(cubic_imag[j * n + i], cubic_expected[j].imag());
+        }
+        const auto quadratic_expected = quadratic_roots<double>(quadratics[i]);
+        for (std::size_t j = 0; j < 2; ++j) {
+            EXPECT_EQ(quadratic_real[j * n + i], quadratic_expected[j].real());
+            EXPECT_EQ(quadratic_imag[j * n + i], quadratic_expected[j].imag());
+        }
+    }
+}
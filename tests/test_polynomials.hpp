@@ -0,0 +1,160 @@
+#pragma once
+
+// Polynomials shared by the tests and the benchmarks, and the measures of how accurately their roots are found.
+
+#include "quartic_roots.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace dm::math::test {
+
+/// s (x - r0)(x - r1)(x - r2)(x - r3)
+[[nodiscard]] inline std::array<double, 5>
+quartic_from_real_roots(const double r0, const double r1, const double r2, const double r3, const double s = 1.0)
+{
+    return {
+        s * r0 * r1 * r2 * r3,
+        -s * (r0 * r1 * r2 + r0 * r1 * r3 + r0 * r2 * r3 + r1 * r2 * r3),
+        s * (r0 * r1 + r0 * r2 + r0 * r3 + r1 * r2 + r1 * r3 + r2 * r3),
+        -s * (r0 + r1 + r2 + r3),
+        s,
+    };
+}
+
+/// five quartics covering four real roots, two complex pairs, one of each, and non-monic leading coefficients
+[[nodiscard]] inline std::vector<std::array<double, 5>> make_quartics()
+{
+    return {
+        {24.0, -50.0, 35.0, -10.0, 1.0}, // 1, 2, 3, 4
+        {4.0, 0.0, 5.0, 0.0, 1.0},       // +-i, +-2i
+        {-6.0, 2.0, 1.0, 2.0, 1.0},      // real pair and complex pair
+        {1.0, 2.0, 3.0, 4.0, 5.0},
+        {-3.0, 0.5, 7.0, -2.0, 2.0},
+    };
+}
+
+/// `n` quartics with four real roots drawn uniformly from [-4, 4], each scaled by a factor drawn uniformly from
+/// [min_scale, max_scale]; the same seed gives the same quartics
+[[nodiscard]] inline std::vector<std::array<double, 5>> random_real_root_quartics(
+    const std::size_t n, const double min_scale = 1.0, const double max_scale = 1.0, const std::uint64_t seed = 42
+)
+{
+    std::mt19937_64 generator{seed};
+    std::uniform_real_distribution<double> root{-4, 4};
+    std::uniform_real_distribution<double> scale{min_scale, max_scale};
+    std::vector<std::array<double, 5>> quartics(n);
+    for (auto& c : quartics) {
+        const auto r0 = root(generator);
+        const auto r1 = root(generator);
+        const auto r2 = root(generator);
+        const auto r3 = root(generator);
+        c = quartic_from_real_roots(r0, r1, r2, r3, scale(generator));
+    }
+    return quartics;
+}
+
+/// distance from each of `expected` to its nearest computed root, pairing the expected roots in order, each with a
+/// root not already taken by an earlier one
+template <std::size_t N, typename Root>
+[[nodiscard]] std::array<double, N>
+nearest_root_distances(const std::array<std::complex<double>, N>& expected, const std::array<Root, N>& roots)
+{
+    std::array<bool, N> used{};
+    std::array<double, N> distances;
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t nearest = 0;
+        double nearest_distance = std::numeric_limits<double>::infinity();
+        for (std::size_t j = 0; j < N; ++j) {
+            const auto distance = std::abs(std::complex<double>(roots[j]) - expected[i]);
+            if (!used[j] && distance < nearest_distance) {
+                nearest = j;
+                nearest_distance = distance;
+            }
+        }
+        used[nearest] = true;
+        distances[i] = nearest_distance;
+    }
+    return distances;
+}
+
+/// largest of `nearest_root_distances`
+template <std::size_t N, typename Root>
+[[nodiscard]] double root_error(const std::array<std::complex<double>, N>& expected, const std::array<Root, N>& roots)
+{
+    const auto distances = nearest_root_distances(expected, roots);
+    return *std::max_element(distances.begin(), distances.end());
+}
+
+/// error of solving quartics from compact storage instead of the double coefficients they were made from
+struct QuantizationReport
+{
+    std::size_t n_polynomials;
+    /// largest coefficient error relative to the largest coefficient of its polynomial
+    double max_coefficient_error;
+    /// largest and mean root error relative to max(1, |root|), pairing each reference root with its nearest
+    double max_root_error;
+    double mean_root_error;
+    /// polynomials whose compact roots are not all finite while the reference roots are
+    std::size_t n_nonfinite;
+};
+
+/// compares `quartic_roots` of every polynomial of `reference` (double) with those of `compact` solved in `Real`;
+/// all-zero reference polynomials have no roots or relative error and are skipped
+template <typename Real, typename ReferenceBatch, typename CompactBatch>
+[[nodiscard]] QuantizationReport
+quartic_quantization_report(const ReferenceBatch& reference, const CompactBatch& compact)
+{
+    QuantizationReport report{std::size(reference), 0, 0, 0, 0};
+    std::size_t n_roots = 0;
+    for (std::size_t i = 0; i < report.n_polynomials; ++i) {
+        std::array<double, 5> exact;
+        std::array<Real, 5> widened;
+        double scale = 0;
+        for (std::size_t k = 0; k < 5; ++k) {
+            exact[k] = static_cast<double>(reference[i][k]);
+            widened[k] = compact[i][k];
+            scale = std::max(scale, std::abs(exact[k]));
+        }
+        if (scale == 0) {
+            continue;
+        }
+        for (std::size_t k = 0; k < 5; ++k) {
+            const auto error = std::abs(static_cast<double>(widened[k]) - exact[k]) / scale;
+            report.max_coefficient_error = std::max(report.max_coefficient_error, error);
+        }
+
+        const auto expected = quartic_roots<double>(exact);
+        const auto roots = quartic_roots<Real>(widened);
+        const auto finite = [](const auto& r) {
+            return std::isfinite(r.real()) && std::isfinite(r.imag());
+        };
+        if (!std::all_of(expected.begin(), expected.end(), finite)) {
+            continue;
+        }
+        if (!std::all_of(roots.begin(), roots.end(), finite)) {
+            ++report.n_nonfinite;
+            continue;
+        }
+        const auto distances = nearest_root_distances(expected, roots);
+        for (std::size_t j = 0; j < 4; ++j) {
+            const auto error = distances[j] / std::max(1.0, std::abs(expected[j]));
+            report.max_root_error = std::max(report.max_root_error, error);
+            report.mean_root_error += error;
+            ++n_roots;
+        }
+    }
+    if (n_roots > 0) {
+        report.mean_root_error /= static_cast<double>(n_roots);
+    }
+    return report;
+}
+
+} // namespace dm::math::test
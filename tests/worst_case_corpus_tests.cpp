@@ -0,0 +1,106 @@
+#include "quartic_roots.hpp"
+#include "worst_case_corpus.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace dm::math;
+
+namespace {
+
+std::vector<CorpusEntry> load_corpus()
+{
+    std::ifstream in{POLYNOMIAL_ROOTS_WORST_CASE_CORPUS};
+    EXPECT_TRUE(in.is_open()) << POLYNOMIAL_ROOTS_WORST_CASE_CORPUS;
+    return read_corpus(in);
+}
+
+} // namespace
+
+TEST(WorstCaseCorpus, RoundTripsExactly)
+{
+    const std::vector<CorpusEntry> entries{
+        {Outlier::latency, 512.5, {0.1, -0.0, 3e-310, -1e300, 1.0 / 3}},
+        {Outlier::residual, 1e-9, {1, 2, 3, 4, 5}},
+        {Outlier::nonfinite, 0, {-1, 0, 0, 0, std::numeric_limits<double>::min()}},
+        {Outlier::known_residual, 0.1 + 0.2, {0, 0, 1, 1e6, 1}},
+    };
+    std::stringstream buffer;
+    buffer << "# comment\n\n";
+    write_corpus(buffer, entries);
+
+    const auto read = read_corpus(buffer);
+    ASSERT_EQ(read.size(), entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        EXPECT_EQ(read[i].kind, entries[i].kind);
+        EXPECT_EQ(read[i].score, entries[i].score);
+        EXPECT_EQ(read[i].coefficients, entries[i].coefficients);
+        EXPECT_EQ(std::signbit(read[i].coefficients[1]), std::signbit(entries[i].coefficients[1]));
+    }
+}
+
+TEST(WorstCaseCorpus, RejectsMalformedLines)
+{
+    std::istringstream unknown_kind{"slow 1 0x1p+0 0 0 0 1\n"};
+    EXPECT_THROW(static_cast<void>(read_corpus(unknown_kind)), std::runtime_error);
+    std::istringstream missing_coefficient{"latency 1 0x1p+0 0 0 1\n"};
+    EXPECT_THROW(static_cast<void>(read_corpus(missing_coefficient)), std::runtime_error);
+    std::istringstream bad_number{"residual 1 0x1p+0 0 zero 0 1\n"};
+    EXPECT_THROW(static_cast<void>(read_corpus(bad_number)), std::runtime_error);
+}
+
+TEST(WorstCaseCorpus, BackwardErrorOfExactRootsIsZero)
+{
+    // 2 (x - 1)(x + 2)(x^2 + 1)
+    const std::array<double, 5> c{-4, 2, -2, 2, 2};
+    const std::array<std::complex<double>, 4> roots{{{1, 0}, {-2, 0}, {0, 1}, {0, -1}}};
+    EXPECT_EQ(quartic_backward_error(c, roots), 0);
+    const std::array<std::complex<double>, 4> wrong{{{1, 0}, {-2, 0}, {0, 1}, {0, 1}}};
+    EXPECT_GT(quartic_backward_error(c, wrong), 0.5);
+    const std::array<std::complex<double>, 4> nan{{{1, 0}, {-2, 0}, {0, 1}, {std::nan(""), 0}}};
+    EXPECT_EQ(quartic_backward_error(c, nan), std::numeric_limits<double>::infinity());
+}
+
+TEST(WorstCaseCorpus, EveryEntryHasFiniteRoots)
+{
+    const auto corpus = load_corpus();
+    ASSERT_FALSE(corpus.empty());
+    for (const auto& entry : corpus) {
+        EXPECT_TRUE(in_search_domain(entry.coefficients));
+        const auto roots = quartic_roots<double>(entry.coefficients);
+        for (const auto& root : roots) {
+            EXPECT_TRUE(std::isfinite(root.real()) && std::isfinite(root.imag()))
+                << to_string(entry.kind) << " entry " << entry.coefficients[0] << " " << entry.coefficients[1] << " "
+                << entry.coefficients[2] << " " << entry.coefficients[3] << " " << entry.coefficients[4];
+        }
+    }
+}
+
+TEST(WorstCaseCorpus, ResidualsDoNotRegress)
+{
+    // The scores are the errors when the corpus was generated, stored exactly; another compiler's rounding moves the
+    // error of these inputs by far less than the slack. Entries of the known inaccurate region, whose small roots keep
+    // no correct digits, only have to stay finite.
+    for (const auto& entry : load_corpus()) {
+        if (entry.kind == Outlier::known_residual) {
+            EXPECT_TRUE(known_inaccurate(entry.coefficients));
+        }
+        if (entry.kind != Outlier::residual) {
+            continue;
+        }
+        EXPECT_FALSE(known_inaccurate(entry.coefficients));
+        const auto error = quartic_backward_error(entry.coefficients, quartic_roots<double>(entry.coefficients));
+        EXPECT_LE(error, entry.score + 1e-12)
+            << "entry " << entry.coefficients[0] << " " << entry.coefficients[1] << " " << entry.coefficients[2] << " "
+            << entry.coefficients[3] << " " << entry.coefficients[4];
+    }
+}
@@ -0,0 +1,32 @@
+// libFuzzer entry point: reads five doubles (lowest degree first) from each input and traps when `quartic_roots`
+// returns a non-finite root for coefficients in `in_search_domain`, so libFuzzer saves the input as a crash.
+//
+//     polynomial_roots_fuzzer [libFuzzer options] [corpus directories]
+//
+// Saved crashes can be added to the regression corpus as `nonfinite 0 c0 c1 c2 c3 c4` lines.
+
+#include "quartic_roots.hpp"
+#include "worst_case_corpus.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    std::array<double, 5> c;
+    if (size < sizeof(c)) {
+        return 0;
+    }
+    std::memcpy(c.data(), data, sizeof(c));
+    if (!dm::math::in_search_domain(c)) {
+        return 0;
+    }
+    const auto roots = dm::math::quartic_roots<double>(c);
+    if (!std::isfinite(dm::math::quartic_backward_error(c, roots))) {
+        __builtin_trap();
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+// Serves quartic solves to local processes over a Unix domain socket, see solver_service.hpp for the protocol.
+//
+//     polynomial_roots_daemon [--socket PATH] [--latency-us N] [--max-batch N]
+
+#include "solver_service.hpp"
+
+#include <signal.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string>
+
+namespace {
+
+std::atomic<dm::math::service::Server*> running_server{nullptr};
+
+extern "C" void stop_running_server(int)
+{
+    if (auto* server = running_server.load()) {
+        server->stop();
+    }
+}
+
+[[noreturn]] void usage(const char* program)
+{
+    std::fprintf(stderr, "usage: %s [--socket PATH] [--latency-us N] [--max-batch N]\n", program);
+    std::exit(2);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    dm::math::service::ServerOptions options;
+    options.socket_path = "/tmp/polynomial_roots.sock";
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 == argc) {
+            usage(argv[0]);
+        }
+        const auto value = argv[++i];
+        if (std::strcmp(argv[i - 1], "--socket") == 0) {
+            options.socket_path = value;
+        } else if (std::strcmp(argv[i - 1], "--latency-us") == 0) {
+            options.latency_budget = std::chrono::microseconds{std::strtoll(value, nullptr, 10)};
+        } else if (std::strcmp(argv[i - 1], "--max-batch") == 0) {
+            options.max_batch = std::strtoull(value, nullptr, 10);
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    try {
+        dm::math::service::Server server{options};
+        running_server = &server;
+        struct sigaction action{};
+        action.sa_handler = stop_running_server;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGINT, &action, nullptr);
+        sigaction(SIGTERM, &action, nullptr);
+        signal(SIGPIPE, SIG_IGN);
+
+        server.run();
+        running_server = nullptr;
+
+        const auto stats = server.stats();
+        std::fprintf(
+            stderr, "%zu connections, %zu requests, %zu polynomials in %zu batches (largest %zu)\n",
+            stats.n_connections, stats.n_requests, stats.n_polynomials, stats.n_batches, stats.largest_batch
+        );
+    } catch (const std::exception& error) {
+        std::fprintf(stderr, "%s: %s\n", argv[0], error.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,399 @@
+// Searches coefficient space for quartics on which `quartic_roots<double>` is slowest, least accurate or not finite,
+// and writes the worst inputs found as a corpus (see worst_case_corpus.hpp) for the regression tests and benchmarks.
+//
+//     polynomial_roots_worst_cases [--iterations N] [--seed N] [--keep N] [--output PATH]
+//
+// The search keeps the `keep` worst inputs of each kind and mostly mutates them: nudging a coefficient by a few ulps
+// or a relative step, zeroing it, or scaling the variable by a power of two. The rest of the time it draws fresh
+// inputs from generators aimed at the solver's weak regions: clustered real roots, which drive the `acos` argument of
+// the cubic towards +-1 and q towards 0; complex pairs close to the real axis, whose resolvent roots land either side
+// of zero; and roots of very different magnitudes. Inputs outside `in_search_domain` are discarded.
+//
+// Where a Clang toolchain is available, quartic_fuzzer.cpp offers the same search for non-finite roots to libFuzzer's
+// coverage guidance.
+
+#include "quartic_roots.hpp"
+#include "worst_case_corpus.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace dm::math;
+
+namespace {
+
+using Coefficients = std::array<double, 5>;
+
+struct Options
+{
+    std::size_t iterations = 200000;
+    std::uint64_t seed = 1;
+    std::size_t keep = 16;
+    std::string output = "worst_cases.txt";
+};
+
+[[noreturn]] void usage(const char* program)
+{
+    std::fprintf(stderr, "usage: %s [--iterations N] [--seed N] [--keep N] [--output PATH]\n", program);
+    std::exit(2);
+}
+
+[[nodiscard]] std::uint64_t ticks() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count()
+    );
+#endif
+}
+
+/// fastest of `rounds` runs of `repetitions` solves, in ticks per solve
+[[nodiscard]] double time_solve(const Coefficients& c, const int rounds, const int repetitions) noexcept
+{
+    // the volatile reads and writes keep the compiler from hoisting the solve out of the loop
+    volatile double input[5] = {c[0], c[1], c[2], c[3], c[4]};
+    volatile double sink = 0;
+    auto best = std::numeric_limits<double>::infinity();
+    for (int round = 0; round < rounds; ++round) {
+        const auto start = ticks();
+        for (int repetition = 0; repetition < repetitions; ++repetition) {
+            const Coefficients fresh{input[0], input[1], input[2], input[3], input[4]};
+            const auto roots = quartic_roots<double>(fresh);
+            sink = roots[0].real() + roots[3].imag();
+        }
+        best = std::min(best, static_cast<double>(ticks() - start) / repetitions);
+    }
+    static_cast<void>(sink);
+    return best;
+}
+
+/// real coefficients of scale * (x - roots[0]) * ... * (x - roots[3]), for roots closed under conjugation
+[[nodiscard]] Coefficients from_roots(const std::array<std::complex<double>, 4>& roots, const double scale) noexcept
+{
+    std::array<std::complex<double>, 5> expanded{1.0, 0.0, 0.0, 0.0, 0.0};
+    for (std::size_t j = 0; j < 4; ++j) {
+        for (std::size_t k = j + 1; k > 0; --k) {
+            expanded[k] = expanded[k - 1] - roots[j] * expanded[k];
+        }
+        expanded[0] *= -roots[j];
+    }
+    Coefficients c;
+    for (std::size_t k = 0; k < 5; ++k) {
+        c[k] = scale * expanded[k].real();
+    }
+    return c;
+}
+
+class Explorer
+{
+  public:
+    explicit Explorer(const Options& options) : options_(options), generator_(options.seed) {}
+
+    void run()
+    {
+        for (std::size_t iteration = 0; iteration < options_.iterations; ++iteration) {
+            const auto c = (uniform(generator_) < 0.75) ? mutate(pick_parent()) : generate();
+            if (in_search_domain(c)) {
+                evaluate(c);
+            }
+        }
+        // re-time the slowest inputs more carefully, since single measurements of a ~100-cycle solve are noisy
+        for (auto& entry : elites_[0]) {
+            entry.score = time_solve(entry.coefficients, 15, 256);
+        }
+        std::sort(elites_[0].begin(), elites_[0].end(), [](const auto& a, const auto& b) {
+            return a.score > b.score;
+        });
+    }
+
+    [[nodiscard]] std::vector<CorpusEntry> corpus() const
+    {
+        std::vector<CorpusEntry> entries;
+        for (const auto& elites : elites_) {
+            entries.insert(entries.end(), elites.begin(), elites.end());
+        }
+        return entries;
+    }
+
+    [[nodiscard]] double baseline_latency() const noexcept
+    {
+        return baseline_latency_;
+    }
+
+    [[nodiscard]] std::size_t n_evaluated() const noexcept
+    {
+        return n_evaluated_;
+    }
+
+    [[nodiscard]] std::size_t n_nonfinite() const noexcept
+    {
+        return n_nonfinite_;
+    }
+
+  private:
+    [[nodiscard]] double log_uniform(const double low_exponent, const double high_exponent)
+    {
+        return std::pow(10.0, low_exponent + (high_exponent - low_exponent) * uniform(generator_));
+    }
+
+    [[nodiscard]] double sign()
+    {
+        return (uniform(generator_) < 0.5) ? -1.0 : 1.0;
+    }
+
+    [[nodiscard]] Coefficients generate()
+    {
+        const auto scale = sign() * log_uniform(-3, 3);
+        switch (std::uniform_int_distribution<int>{0, 4}(generator_)) {
+        case 0: {
+            Coefficients c;
+            for (auto& coefficient : c) {
+                coefficient = (uniform(generator_) < 0.2) ? 0.0 : sign() * log_uniform(-3, 3);
+            }
+            c[4] = scale;
+            return c;
+        }
+        case 1: {
+            // three or four real roots within `spread` of a centre
+            const auto centre = 20 * uniform(generator_) - 10;
+            const auto spread = log_uniform(-9, 0);
+            std::array<std::complex<double>, 4> roots;
+            for (auto& root : roots) {
+                root = centre + spread * (2 * uniform(generator_) - 1);
+            }
+            if (uniform(generator_) < 0.5) {
+                roots[3] = 20 * uniform(generator_) - 10;
+            }
+            return from_roots(roots, scale);
+        }
+        case 2: {
+            // complex pairs close to the real axis
+            const auto a = 20 * uniform(generator_) - 10;
+            const auto b = (uniform(generator_) < 0.5) ? a : 20 * uniform(generator_) - 10;
+            const auto y1 = log_uniform(-9, 0);
+            const auto y2 = log_uniform(-9, 0);
+            return from_roots({{{a, y1}, {a, -y1}, {b, y2}, {b, -y2}}}, scale);
+        }
+        case 3: {
+            // a double pair (x - a)^2 (x - b)^2
+            const auto a = 20 * uniform(generator_) - 10;
+            const auto b = 20 * uniform(generator_) - 10;
+            return from_roots({{a, a, b, b}}, scale);
+        }
+        default: {
+            std::array<std::complex<double>, 4> roots;
+            for (auto& root : roots) {
+                root = sign() * log_uniform(-3, 3);
+            }
+            return from_roots(roots, scale);
+        }
+        }
+    }
+
+    [[nodiscard]] Coefficients mutate(Coefficients c)
+    {
+        const auto k = std::uniform_int_distribution<std::size_t>{0, 4}(generator_);
+        switch (std::uniform_int_distribution<int>{0, 4}(generator_)) {
+        case 0: {
+            const auto n_ulps = std::uniform_int_distribution<int>{1, 16}(generator_);
+            const auto direction = sign() * std::numeric_limits<double>::infinity();
+            for (int step = 0; step < n_ulps; ++step) {
+                c[k] = std::nextafter(c[k], direction);
+            }
+            break;
+        }
+        case 1:
+            c[k] *= 1 + sign() * log_uniform(-12, -2);
+            break;
+        case 2:
+            if (k < 4) {
+                c[k] = 0;
+            }
+            break;
+        case 3: {
+            // x -> s x with s a power of two scales every root by 1/s without rounding the coefficients
+            const auto exponent = std::uniform_int_distribution<int>{-4, 4}(generator_);
+            for (std::size_t j = 0; j < 5; ++j) {
+                c[j] = std::ldexp(c[j], exponent * static_cast<int>(j));
+            }
+            break;
+        }
+        default:
+            // x -> -x negates every root
+            c[1] = -c[1];
+            c[3] = -c[3];
+            break;
+        }
+        return c;
+    }
+
+    [[nodiscard]] Coefficients pick_parent()
+    {
+        const auto& elites = elites_[std::uniform_int_distribution<std::size_t>{0, elites_.size() - 1}(generator_)];
+        if (elites.empty()) {
+            return generate();
+        }
+        return elites[std::uniform_int_distribution<std::size_t>{0, elites.size() - 1}(generator_)].coefficients;
+    }
+
+    void evaluate(const Coefficients& c)
+    {
+        ++n_evaluated_;
+        const auto roots = quartic_roots<double>(c);
+        const auto error = quartic_backward_error(c, roots);
+        if (!std::isfinite(error)) {
+            ++n_nonfinite_;
+            consider({Outlier::nonfinite, 0, c});
+        } else {
+            consider({known_inaccurate(c) ? Outlier::known_residual : Outlier::residual, error, c});
+        }
+        const auto latency = time_solve(c, 3, 16);
+        baseline_latency_ += (latency - baseline_latency_) / static_cast<double>(n_evaluated_);
+        consider({Outlier::latency, latency, c});
+    }
+
+    /// Keeps `entry` if it is worse than the least bad of the `keep` entries of its kind. Entries in the same region
+    /// (see `same_region`) replace each other instead, so that one bad input and its mutations do not fill the corpus.
+    void consider(const CorpusEntry& entry)
+    {
+        auto& elites = elites_[static_cast<std::size_t>(entry.kind)];
+        const auto by_score = [](const auto& a, const auto& b) { return a.score > b.score; };
+        for (auto& elite : elites) {
+            if (same_region(elite.coefficients, entry.coefficients)) {
+                if (entry.score > elite.score) {
+                    elite = entry;
+                    std::sort(elites.begin(), elites.end(), by_score);
+                }
+                return;
+            }
+        }
+        if (elites.size() == options_.keep) {
+            if (entry.score <= elites.back().score) {
+                return;
+            }
+            elites.pop_back();
+        }
+        elites.insert(std::upper_bound(elites.begin(), elites.end(), entry, by_score), entry);
+    }
+
+    /// `c` with its roots scaled to a Cauchy-style bound of one, x -> R x for R = max (|c[k]| / |c[4]|)^(1 / (4 - k)),
+    /// and divided by its largest coefficient; the same for c(x) and c(s x) for every power of two s
+    [[nodiscard]] static Coefficients canonical(const Coefficients& c) noexcept
+    {
+        double bound = 0;
+        for (std::size_t k = 0; k < 4; ++k) {
+            if (c[k] != 0) {
+                bound = std::max(bound, std::pow(std::abs(c[k] / c[4]), 1.0 / static_cast<double>(4 - k)));
+            }
+        }
+        bound = (bound > 0) ? bound : 1;
+        Coefficients scaled;
+        double largest = 0;
+        for (std::size_t k = 0; k < 5; ++k) {
+            scaled[k] = c[k] * std::pow(bound, static_cast<double>(k));
+            largest = std::max(largest, std::abs(scaled[k]));
+        }
+        for (auto& coefficient : scaled) {
+            coefficient /= largest;
+        }
+        return scaled;
+    }
+
+    /// Whether the `canonical` forms of `a` and `b` differ by at most 1/16 in every coefficient, as they are or with
+    /// one of them negated or with its roots negated. Coefficients far below the largest do not tell regions apart, so
+    /// an input and its mutations, which mostly move, zero or rescale such coefficients, share one.
+    [[nodiscard]] static bool same_region(const Coefficients& a, const Coefficients& b) noexcept
+    {
+        const auto canonical_a = canonical(a);
+        const auto canonical_b = canonical(b);
+        // bit 0 negates b, bit 1 negates its roots
+        for (int transform = 0; transform < 4; ++transform) {
+            bool close = true;
+            for (std::size_t k = 0; k < 5; ++k) {
+                const auto negate = ((transform & 1) != 0) != ((transform & 2) != 0 && k % 2 == 1);
+                close = close && std::abs(canonical_a[k] - (negate ? -canonical_b[k] : canonical_b[k])) <= 1.0 / 16;
+            }
+            if (close) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Options options_;
+    std::mt19937_64 generator_;
+    std::uniform_real_distribution<double> uniform{0, 1};
+    /// worst first, indexed by `Outlier`
+    std::array<std::vector<CorpusEntry>, 4> elites_;
+    double baseline_latency_ = 0;
+    std::size_t n_evaluated_ = 0;
+    std::size_t n_nonfinite_ = 0;
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 == argc) {
+            usage(argv[0]);
+        }
+        const auto value = argv[++i];
+        if (std::strcmp(argv[i - 1], "--iterations") == 0) {
+            options.iterations = std::strtoull(value, nullptr, 10);
+        } else if (std::strcmp(argv[i - 1], "--seed") == 0) {
+            options.seed = std::strtoull(value, nullptr, 10);
+        } else if (std::strcmp(argv[i - 1], "--keep") == 0) {
+            options.keep = std::max<std::size_t>(std::strtoull(value, nullptr, 10), 1);
+        } else if (std::strcmp(argv[i - 1], "--output") == 0) {
+            options.output = value;
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    Explorer explorer{options};
+    explorer.run();
+    const auto corpus = explorer.corpus();
+
+    std::ofstream out{options.output};
+    out << "# polynomial_roots_worst_cases --iterations " << options.iterations << " --seed " << options.seed
+        << " --keep " << options.keep << "\n# kind score c0 c1 c2 c3 c4\n";
+    write_corpus(out, corpus);
+    if (!out) {
+        std::fprintf(stderr, "%s: cannot write %s\n", argv[0], options.output.c_str());
+        return 1;
+    }
+
+    std::printf(
+        "%zu inputs evaluated, %zu with non-finite roots, mean latency %.1f ticks\n", explorer.n_evaluated(),
+        explorer.n_nonfinite(), explorer.baseline_latency()
+    );
+    for (const auto& entry : corpus) {
+        if (&entry == &corpus.front() || entry.kind != (&entry - 1)->kind) {
+            std::printf("worst %s: %g\n", to_string(entry.kind), entry.score);
+        }
+    }
+    return 0;
+}